@@ -68,6 +68,7 @@ LOCAL_SRC_FILES:= \
 		glslang/MachineIndependent/Scan.cpp \
 		glslang/MachineIndependent/ShaderLang.cpp \
 		glslang/MachineIndependent/SymbolTable.cpp \
+		glslang/MachineIndependent/SymbolTableSnapshot.cpp \
 		glslang/MachineIndependent/Versions.cpp \
 		glslang/MachineIndependent/preprocessor/PpAtom.cpp \
 		glslang/MachineIndependent/preprocessor/PpContext.cpp \
@@ -45,6 +45,12 @@ namespace glslang {
 
 OS_TLSIndex ThreadInitializeIndex = OS_INVALID_TLS_INDEX;
 
+#ifdef ENABLE_THREAD_LOCAL
+// The init flag, in native TLS; ThreadInitializeIndex then only marks the
+// process as initialized.
+thread_local bool ThreadInitialized = false;
+#endif
+
 // Per-process initialization.
 // Needs to be called at least once before parsing, etc. is done.
 // Will also do thread initialization for the calling thread; other
@@ -102,6 +108,12 @@ bool InitThread()
         return false;
     }
 
+#ifdef ENABLE_THREAD_LOCAL
+    if (ThreadInitialized)
+        return true;
+
+    ThreadInitialized = true;
+#else
     if (OS_GetTLSValue(ThreadInitializeIndex) != 0)
         return true;
 
@@ -109,6 +121,7 @@ bool InitThread()
         assert(0 && "InitThread(): Unable to set init flag.");
         return false;
     }
+#endif
 
     glslang::SetThreadPoolAllocator(nullptr);
 
@@ -130,12 +143,16 @@ bool DetachThread()
     //
     // Function is re-entrant and this thread may not have been initialized.
     //
+#ifdef ENABLE_THREAD_LOCAL
+    ThreadInitialized = false;
+#else
     if (OS_GetTLSValue(ThreadInitializeIndex) != 0) {
         if (!OS_SetTLSValue(ThreadInitializeIndex, (void *)0)) {
             assert(0 && "DetachThread(): Unable to clear init flag.");
             success = false;
         }
     }
+#endif
 
     return success;
 }
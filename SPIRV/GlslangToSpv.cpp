@@ -139,6 +139,8 @@ public:
 
     void finishSpv();
     void dumpSpv(std::vector<unsigned int>& out);
+    size_t getMemoryBytes() const { return builder.getMemoryBytes(); }
+    size_t getPeakMemoryBytes() const { return builder.getPeakMemoryBytes(); }
 
 protected:
     TGlslangToSpvTraverser(TGlslangToSpvTraverser&);
@@ -5071,7 +5073,7 @@ spv::Id TGlslangToSpvTraverser::createImageTextureFunctionCall(glslang::TIntermO
     if (cracked.gather) {
         const auto& sourceExtensions = glslangIntermediate->getRequestedExtensions();
         if (bias || cracked.lod ||
-            sourceExtensions.find(glslang::E_GL_AMD_texture_gather_bias_lod) != sourceExtensions.end()) {
+            sourceExtensions.find(glslang::E_GL_AMD_texture_gather_bias_lod.name) != sourceExtensions.end()) {
             builder.addExtension(spv::E_SPV_AMD_texture_gather_bias_lod);
             builder.addCapability(spv::CapabilityImageGatherBiasLodAMD);
         }
@@ -8639,7 +8641,7 @@ void GetSpirvVersion(std::string& version)
 }
 
 // For low-order part of the generator's magic number. Bump up
-// when there is a change in the style (e.g., if SSA form changes,
+// GLSLANG_SPIRV_GENERATOR_VERSION when there is a change in the style (e.g., if SSA form changes,
 // or a different instruction sequence to do something gets used).
 int GetSpirvGeneratorVersion()
 {
@@ -8651,7 +8653,8 @@ int GetSpirvGeneratorVersion()
     // return 6; // revert version 5 change, which makes a different (new) kind of incorrect code,
                  // versions 4 and 6 each generate OpArrayLength as it has long been done
     // return 7; // GLSL volatile keyword maps to both SPIR-V decorations Volatile and Coherent
-    return 8; // switch to new dead block eliminator; use OpUnreachable
+    // return 8; // switch to new dead block eliminator; use OpUnreachable
+    return GLSLANG_SPIRV_GENERATOR_VERSION;
 }
 
 // Write SPIR-V out to a binary file
@@ -8729,6 +8732,10 @@ void GlslangToSpv(const TIntermediate& intermediate, std::vector<unsigned int>&
     root->traverse(&it);
     it.finishSpv();
     it.dumpSpv(spirv);
+    if (intermediate.getSpirvMemoryRecord() != nullptr) {
+        intermediate.getSpirvMemoryRecord()->current = it.getMemoryBytes();
+        intermediate.getSpirvMemoryRecord()->peak = it.getPeakMemoryBytes();
+    }
 
 #if ENABLE_OPT
     // If from HLSL, run spirv-opt to "legalize" the SPIR-V for Vulkan
@@ -72,6 +72,7 @@ Builder::Builder(unsigned int spvVersion, unsigned int magicNumber, SpvBuildLogg
     uniqueId(0),
     entryPointFunction(0),
     generatingOpCodeForSpecConst(false),
+    peakMemoryBytes(0),
     logger(buildLogger)
 {
     clearAccessChain();
@@ -2882,6 +2883,22 @@ void Builder::dump(std::vector<unsigned int>& out) const
     module.dump(out);
 }
 
+size_t Builder::getMemoryBytes() const
+{
+    size_t bytes = module.getMemoryBytes();
+
+    const std::vector<std::unique_ptr<Instruction> >* sections[] = {
+        &strings, &imports, &entryPoints, &executionModes, &names, &decorations, &constantsTypesGlobals, &externals
+    };
+    for (auto section : sections) {
+        bytes += section->capacity() * sizeof(std::unique_ptr<Instruction>);
+        for (auto& instruction : *section)
+            bytes += instruction->getMemoryBytes();
+    }
+
+    return bytes;
+}
+
 //
 // Protected methods.
 //
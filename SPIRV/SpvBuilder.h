@@ -743,6 +743,10 @@ public:
 
     void dump(std::vector<unsigned int>&) const;
 
+    // Bytes of memory held for the module being built, now, and at most so far.
+    size_t getMemoryBytes() const;
+    size_t getPeakMemoryBytes() const { return std::max(peakMemoryBytes, getMemoryBytes()); }
+
     void createBranch(Block* block);
     void createConditionalBranch(Id condition, Block* thenBlock, Block* elseBlock);
     void createLoopMerge(Block* mergeBlock, Block* continueBlock, unsigned int control,
@@ -796,6 +800,7 @@ public:
     Function* entryPointFunction;
     bool generatingOpCodeForSpecConst;
     AccessChain accessChain;
+    size_t peakMemoryBytes;    // measured before instructions are removed, as only then does the module shrink
 
     // special blocks of instructions for output
     std::vector<std::unique_ptr<Instruction> > strings;
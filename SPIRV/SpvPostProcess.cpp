@@ -441,6 +441,8 @@ void Builder::postProcessFeatures() {
 
 // comment in header
 void Builder::postProcess() {
+  // Unneeded decorations are about to be removed.
+  peakMemoryBytes = std::max(peakMemoryBytes, getMemoryBytes());
   postProcessCFG();
 #ifndef GLSLANG_WEB
   postProcessFeatures();
@@ -177,6 +177,13 @@ public:
             out.push_back(operands[op]);
     }
 
+    // Bytes of memory held for the instruction, beyond sizeof(Instruction).
+    size_t getOperandMemoryBytes() const
+    {
+        return operands.capacity() * sizeof(Id) + (idOperand.capacity() + 7) / 8;
+    }
+    size_t getMemoryBytes() const { return sizeof(Instruction) + getOperandMemoryBytes(); }
+
 protected:
     Instruction(const Instruction&);
     Id resultId;
@@ -280,6 +287,19 @@ public:
             instructions[i]->dump(out);
     }
 
+    size_t getMemoryBytes() const
+    {
+        size_t bytes = sizeof(Block);
+        bytes += (instructions.capacity() + localVariables.capacity()) * sizeof(std::unique_ptr<Instruction>);
+        bytes += (predecessors.capacity() + successors.capacity()) * sizeof(Block*);
+        for (int i = 0; i < (int)instructions.size(); ++i)
+            bytes += instructions[i]->getMemoryBytes();
+        for (int i = 0; i < (int)localVariables.size(); ++i)
+            bytes += localVariables[i]->getMemoryBytes();
+
+        return bytes;
+    }
+
 protected:
     Block(const Block&);
     Block& operator=(Block&);
@@ -370,6 +390,19 @@ public:
         end.dump(out);
     }
 
+    size_t getMemoryBytes() const
+    {
+        size_t bytes = sizeof(Function) + functionInstruction.getOperandMemoryBytes();
+        bytes += parameterInstructions.capacity() * sizeof(Instruction*);
+        bytes += blocks.capacity() * sizeof(Block*);
+        for (int p = 0; p < (int)parameterInstructions.size(); ++p)
+            bytes += parameterInstructions[p]->getMemoryBytes();
+        for (int b = 0; b < (int)blocks.size(); ++b)
+            bytes += blocks[b]->getMemoryBytes();
+
+        return bytes;
+    }
+
 protected:
     Function(const Function&);
     Function& operator=(Function&);
@@ -421,6 +454,19 @@ public:
             functions[f]->dump(out);
     }
 
+    // Bytes of memory held for the functions, and for mapping result ids.  Instructions
+    // outside of functions are owned, and accounted for, by the spv::Builder.
+    size_t getMemoryBytes() const
+    {
+        size_t bytes = sizeof(Module);
+        bytes += functions.capacity() * sizeof(Function*);
+        bytes += idToInstruction.capacity() * sizeof(Instruction*);
+        for (int f = 0; f < (int)functions.size(); ++f)
+            bytes += functions[f]->getMemoryBytes();
+
+        return bytes;
+    }
+
 protected:
     Module(const Module&);
     std::vector<Function*> functions;
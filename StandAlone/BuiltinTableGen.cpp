@@ -0,0 +1,134 @@
+//
+// Copyright (C) 2020 The Khronos Group Inc.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//    Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+//    Redistributions in binary form must reproduce the above
+//    copyright notice, this list of conditions and the following
+//    disclaimer in the documentation and/or other materials provided
+//    with the distribution.
+//
+//    Neither the name of The Khronos Group Inc. nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+//
+// Build-time generator of built-in symbol table snapshots.
+//
+// Sets up the built-in symbol tables for each configuration named on the
+// command line, and saves them as snapshots into the given directory, for
+// embedding into an executable through glslang::SetBuiltinSnapshots().
+//
+// A configuration is <version>[es|core|compatibility][:vulkan|:opengl][:hlsl],
+// e.g., "310es", "450core:vulkan", or "500:vulkan:hlsl".
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "../glslang/Public/ShaderLang.h"
+
+namespace {
+
+bool ParseConfiguration(const char* text, glslang::TBuiltinConfiguration& configuration)
+{
+    char* end;
+    configuration.version = (int)strtol(text, &end, 10);
+    if (end == text || configuration.version <= 0)
+        return false;
+
+    std::string rest = end;
+    std::string profile = rest.substr(0, rest.find(':'));
+    if (profile == "es")
+        configuration.profile = EEsProfile;
+    else if (profile == "core")
+        configuration.profile = ECoreProfile;
+    else if (profile == "compatibility")
+        configuration.profile = ECompatibilityProfile;
+    else if (profile.size() > 0)
+        return false;
+
+    int messages = EShMsgDefault;
+    rest = rest.substr(profile.size());
+    while (rest.size() > 0) {
+        rest = rest.substr(1);
+        std::string option = rest.substr(0, rest.find(':'));
+        if (option == "vulkan")
+            messages |= EShMsgSpvRules | EShMsgVulkanRules;
+        else if (option == "opengl")
+            messages |= EShMsgSpvRules;
+        else if (option == "hlsl")
+            messages |= EShMsgReadHlsl;
+        else
+            return false;
+        rest = rest.substr(option.size());
+    }
+    configuration.messages = (EShMessages)messages;
+
+    return true;
+}
+
+void Usage()
+{
+    printf("Usage: builtin-table-gen output-directory configuration...\n"
+           "\n"
+           "Saves snapshots of the built-in symbol tables for each configuration\n"
+           "into output-directory, which must already exist.\n"
+           "\n"
+           "A configuration is <version>[es|core|compatibility][:vulkan|:opengl][:hlsl],\n"
+           "e.g., 310es, 450core:vulkan, or 500:vulkan:hlsl.\n");
+}
+
+} // end anonymous namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc < 3) {
+        Usage();
+        return EXIT_FAILURE;
+    }
+
+    std::vector<glslang::TBuiltinConfiguration> configurations(argc - 2);
+    for (int c = 0; c < argc - 2; ++c) {
+        if (! ParseConfiguration(argv[c + 2], configurations[c])) {
+            fprintf(stderr, "builtin-table-gen: unrecognized configuration: %s\n", argv[c + 2]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    glslang::InitializeProcess();
+    glslang::SetBuiltinSnapshotDirectory(argv[1]);
+    bool success = glslang::PrewarmBuiltins(configurations.data(), (int)configurations.size());
+    glslang::FinalizeProcess();
+
+    if (! success) {
+        fprintf(stderr, "builtin-table-gen: invalid version or profile in a configuration\n");
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
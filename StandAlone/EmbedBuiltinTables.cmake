@@ -0,0 +1,51 @@
+# Writes OUTPUT, a C++ source file holding the built-in symbol table snapshots
+# found in SNAPSHOT_DIR, and defining glslang::UseBuiltinTables() to hand them
+# to glslang.  Run with "cmake -DSNAPSHOT_DIR=... -DOUTPUT=... -P".
+
+file(GLOB SNAPSHOTS RELATIVE ${SNAPSHOT_DIR} ${SNAPSHOT_DIR}/*.bin)
+list(SORT SNAPSHOTS)
+
+# matches a line's worth of bytes, as hex
+set(LINE_PATTERN "")
+foreach(BYTE RANGE 1 16)
+    set(LINE_PATTERN "${LINE_PATTERN}[0-9a-f][0-9a-f]")
+endforeach()
+
+set(ARRAYS "")
+set(ENTRIES "")
+set(INDEX 0)
+foreach(SNAPSHOT ${SNAPSHOTS})
+    file(READ ${SNAPSHOT_DIR}/${SNAPSHOT} HEX HEX)
+    string(REGEX REPLACE "(${LINE_PATTERN})" "\\1\n    " HEX "${HEX}")
+    string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," HEX "${HEX}")
+    set(ARRAYS "${ARRAYS}const unsigned char Snapshot${INDEX}[] = {\n    ${HEX}\n};\n\n")
+    set(ENTRIES "${ENTRIES}    { \"${SNAPSHOT}\", Snapshot${INDEX}, sizeof(Snapshot${INDEX}) },\n")
+    math(EXPR INDEX "${INDEX} + 1")
+endforeach()
+
+if(INDEX EQUAL 0)
+    set(USE "    SetBuiltinSnapshots(nullptr, 0);")
+else()
+    set(ARRAYS "${ARRAYS}const glslang::TBuiltinSnapshot Snapshots[] = {\n${ENTRIES}};\n\n")
+    set(USE "    SetBuiltinSnapshots(Snapshots, sizeof(Snapshots) / sizeof(Snapshots[0]));")
+endif()
+
+file(WRITE ${OUTPUT}
+"// Generated by EmbedBuiltinTables.cmake from the output of builtin-table-gen; do not edit.
+
+#include \"BuiltinTables.h\"
+#include \"glslang/Public/ShaderLang.h\"
+
+namespace {
+
+${ARRAYS}} // end anonymous namespace
+
+namespace glslang {
+
+void UseBuiltinTables()
+{
+${USE}
+}
+
+} // end namespace glslang
+")
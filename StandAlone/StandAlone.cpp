@@ -50,6 +50,9 @@
 #include "../SPIRV/GLSL.std.450.h"
 #include "../SPIRV/doc.h"
 #include "../SPIRV/disassemble.h"
+#ifdef ENABLE_BUILTIN_TABLES
+#include "BuiltinTables.h"
+#endif
 
 #include <cstring>
 #include <cstdlib>
@@ -167,6 +170,7 @@ const char* variableName = nullptr;
 bool HlslEnable16BitTypes = false;
 bool HlslDX9compatible = false;
 bool DumpBuiltinSymbols = false;
+const char* BuiltinSnapshotDirectory = nullptr;
 std::vector<std::string> IncludeDirectoryList;
 
 // Source environment
@@ -491,6 +495,11 @@ void ProcessArguments(std::vector<std::unique_ptr<glslang::TWorkItem>>& workItem
                         uniformBase = ::strtol(argv[1], NULL, 10);
                         bumpArg();
                         break;
+                    } else if (lowerword == "builtin-snapshot-dir") {
+                        if (argc <= 1)
+                            Error("no <dir> provided", lowerword.c_str());
+                        BuiltinSnapshotDirectory = argv[1];
+                        bumpArg();
                     } else if (lowerword == "client") {
                         if (argc > 1) {
                             if (strcmp(argv[1], "vulkan100") == 0)
@@ -1311,6 +1320,11 @@ int singleMain()
         glslang::InitializeProcess();  // also test reference counting of users
         glslang::FinalizeProcess();    // also test reference counting of users
         glslang::FinalizeProcess();    // also test reference counting of users
+#ifdef ENABLE_BUILTIN_TABLES
+        glslang::UseBuiltinTables();
+#endif
+        if (BuiltinSnapshotDirectory)
+            glslang::SetBuiltinSnapshotDirectory(BuiltinSnapshotDirectory);
         CompileAndLinkShaderFiles(workList);
         glslang::FinalizeProcess();
     } else {
@@ -1318,6 +1332,12 @@ int singleMain()
         ShInitialize();  // also test reference counting of users
         ShFinalize();    // also test reference counting of users
 
+#ifdef ENABLE_BUILTIN_TABLES
+        glslang::UseBuiltinTables();
+#endif
+        if (BuiltinSnapshotDirectory)
+            glslang::SetBuiltinSnapshotDirectory(BuiltinSnapshotDirectory);
+
         bool printShaderNames = workList.size() > 1;
 
         if (Options & EOptionMultiThreaded) {
@@ -1589,6 +1609,9 @@ void usage()
            "                                    without explicit bindings\n"
            "  --auto-map-locations | --aml      automatically locate input/output lacking\n"
            "                                    'location' (fragile, not cross stage)\n"
+           "  --builtin-snapshot-dir <dir>      load and save built-in symbol table\n"
+           "                                    snapshots in <dir>, to skip generating\n"
+           "                                    them in later runs\n"
            "  --client {vulkan<ver>|opengl<ver>} see -V and -G\n"
            "  --dump-builtin-symbols            prints builtin symbol table prior each compile\n"
            "  -dumpfullversion | -dumpversion   print bare major.minor.patchlevel\n"
@@ -0,0 +1,19 @@
+#version 450
+layout(location=0) out vec4 o;
+const ivec3 a = ivec3(7, -2147483647 - 1, 5) / ivec3(0, -1, 2);
+const uvec2 b = uvec2(9u, 4u) / uvec2(0u, 3u);
+const vec4 c = vec4(1.0, -1.0, 0.0, 3.0) / vec4(0.0);
+const vec3 d = 2.0 - vec3(1.0, 2.5, 3.25);
+const ivec2 e = ivec2(3, 4) * 5 - 1;
+const uvec3 f = 7u + uvec3(1u, 2u, 3u);
+const mat2x3 g = mat2x3(1.1, 2.2, 3.3, 4.4, 5.5, 6.6);
+const vec3 h = g * vec2(0.3, 0.7);
+const vec2 k = vec3(0.1, 0.2, 0.3) * g;
+const mat3x2 l = mat3x2(0.5, 1.5, 2.5, 3.5, 4.5, 5.5);
+const mat2 m = l * g;
+const mat3 n = g * l;
+const vec4 p = vec4(ivec4(-3, 2, 7, 0)) + vec4(uvec4(1u, 2u, 3u, 4u)) + vec4(bvec4(true, false, true, false));
+const ivec3 q = ivec3(vec3(-2.7, 3.9, 1e9)) + ivec3(uvec3(4000000000u, 1u, 2u));
+const bvec2 r = bvec2(ivec2(0, 5));
+const dvec2 s = dvec2(1.0LF, 2.0LF) / 3.0LF;
+void main() { o = vec4(a.x + b.x) + c + vec4(d, 1.0) + vec4(e, f.xy) + vec4(h, k.x) + vec4(m[0], n[1].xy) + p + vec4(q, r.x) + vec4(s, 0.0, 0.0); }
@@ -0,0 +1,35 @@
+#version 450
+
+layout(location = 0) out vec4 color;
+
+// the second call of each signature reuses the first one's resolution
+vec4 first()
+{
+    float a = max(1.0, 2);
+    float b = max(1.0, 2);
+    float c = clamp(a, 0, 1);
+    float d = clamp(b, 0, 1);
+    return vec4(a, b, c, d);
+}
+
+#extension GL_EXT_shader_explicit_arithmetic_types : enable
+
+// extensions can change the conversions, so calls after one are resolved again
+vec4 second()
+{
+    float16_t h = float16_t(1.0);
+    float a = max(1.0, 2);
+    float c = clamp(a, 0, 1);
+    return vec4(a, c, clamp(h, 0, 1), 0.0);
+}
+
+// a user overload hides the built-ins of its name from here on
+float max(float x, int y)
+{
+    return x;
+}
+
+void main()
+{
+    color = first() + second() + vec4(max(1.0, 2), clamp(1.0, 0, 1), 0.0, 0.0);
+}
@@ -0,0 +1,3 @@
+#include "common.h"
+#include "guarded.h"
+float a() { return fromCommon() + guarded(); }
@@ -0,0 +1,2 @@
+#pragma once
+float fromCommon() { return 3.0; }
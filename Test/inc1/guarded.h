@@ -0,0 +1,5 @@
+// a classic include guard
+#ifndef GUARDED_H
+#define GUARDED_H
+float guarded() { return 1.0; }
+#endif // GUARDED_H
@@ -0,0 +1,2 @@
+#pragma once
+float once() { return 2.0; }
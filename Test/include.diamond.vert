@@ -0,0 +1,13 @@
+#version 450
+
+#extension GL_GOOGLE_include_directive : enable
+
+#include "inc1/A.h"
+#include "inc1/B.h"
+
+out vec4 color;
+
+void main()
+{
+    color = vec4(a() + b());
+}
@@ -0,0 +1,15 @@
+#version 450
+
+#extension GL_GOOGLE_include_directive : enable
+
+#include "inc1/guarded.h"
+#include "inc1/once.h"
+#include "inc1/guarded.h"
+#include "inc1/once.h"
+
+out vec4 color;
+
+void main()
+{
+    color = vec4(guarded() + once());
+}
@@ -63,6 +63,7 @@
 
 #include <cstddef>
 #include <cstring>
+#include <type_traits>
 #include <vector>
 
 namespace glslang {
@@ -130,6 +131,23 @@ private:
 #   endif
 };
 
+//
+// What allocations from a pool are for, for accounting of its memory.
+//
+enum TPoolCategory {
+    EPoolAst,             // AST nodes, types, and anything else not below
+    EPoolSymbolTable,     // symbol-table levels, their entries, and symbols copied into them
+    EPoolString,          // contents of pool strings
+    EPoolCategoryCount
+};
+
+struct TPoolUsage {
+    size_t current;       // bytes not yet popped
+    size_t peak;
+};
+
+class TTypeTable;
+
 //
 // There are several stacks.  One is to track the pushing and popping
 // of the user, and not yet implemented.  The others are simply a
@@ -173,8 +191,43 @@ public:
     //
     // Call allocate() to actually acquire memory.  Returns 0 if no memory
     // available, otherwise a properly aligned pointer to 'numBytes' of memory.
+    // The memory is accounted for under 'category', or else under the pool's
+    // current category.
+    //
+    void* allocate(size_t numBytes, TPoolCategory category);
+    void* allocate(size_t numBytes) { return allocate(numBytes, currentCategory); }
+
+    //
+    // The category allocate() accounts memory under when not given one.
+    // setCategory() returns the previous one, for restoring it.
     //
-    void* allocate(size_t numBytes);
+    TPoolCategory setCategory(TPoolCategory category)
+    {
+        TPoolCategory previous = currentCategory;
+        currentCategory = category;
+        return previous;
+    }
+    TPoolCategory getCategory() const { return currentCategory; }
+
+    //
+    // The table typed nodes made in this pool share their types through, if
+    // any; see TTypeTableScope.  setTypeTable() returns the previous one, for
+    // restoring it.
+    //
+    TTypeTable* setTypeTable(TTypeTable* table)
+    {
+        TTypeTable* previous = typeTable;
+        typeTable = table;
+        return previous;
+    }
+    TTypeTable* getTypeTable() const { return typeTable; }
+
+    //
+    // Bytes handed out under a category, and bytes of pages held from the OS,
+    // currently and at their peak.
+    //
+    TPoolUsage getUsage(TPoolCategory) const;
+    TPoolUsage getPageUsage() const;
 
     //
     // There is no deallocate.  The point of this class is that
@@ -183,6 +236,27 @@ public:
     // by calling pop(), and to not have to solve memory leak problems.
     //
 
+    //
+    // Pages of the default size that pools free are kept, per thread, for later
+    // pools to reuse, up to 'bytes' worth, instead of going back to the system.
+    // Trims the calling thread's cache now, other threads' the next time they
+    // free a page.
+    //
+    static void setPageCacheLimit(size_t bytes);
+
+    //
+    // Take new pages of the default size from huge-page backed arenas, where the
+    // OS supports it.  Arena memory is kept for reuse until the process exits.
+    //
+    static void setHugePages(bool);
+
+    //
+    // Process-wide counters: pages held by pools, pages kept in the page caches,
+    // and bytes handed out by allocate() so far.  The last is brought up to date
+    // each time a pool takes a new page or is destroyed.
+    //
+    static void getCounters(size_t& pagesLive, size_t& pagesCached, size_t& bytesAllocated);
+
 protected:
     friend struct tHeader;
 
@@ -210,9 +284,14 @@ protected:
     struct tAllocState {
         size_t offset;
         tHeader* page;
+        size_t categoryBytes[EPoolCategoryCount];
     };
     typedef std::vector<tAllocState> tAllocStack;
 
+    tHeader* newPage();
+    void deletePage(tHeader*, size_t pageCount);
+    void reportBytes();
+
     // Track allocations if and only if we're using guard blocks
 #ifndef GUARD_BLOCKS
     void* initializeAllocation(tHeader*, unsigned char* memory, size_t) {
@@ -239,7 +318,15 @@ protected:
     tAllocStack stack;      // stack of where to allocate from, to partition pool
 
     int numCalls;           // just an interesting statistic
-    size_t totalBytes;      // just an interesting statistic
+    size_t poppedBytes;     // handed out, then popped; the rest is in categoryBytes
+    size_t reportedBytes;   // how much of all bytes handed out is in the process-wide counter
+
+    TPoolCategory currentCategory;
+    size_t categoryBytes[EPoolCategoryCount];       // current, restored by pop()
+    size_t peakCategoryBytes[EPoolCategoryCount];   // brought up to date by pop()
+    size_t pagesHeld;       // in inUseList and freeList, counting multi-page allocations' pages
+    size_t peakPagesHeld;
+    TTypeTable* typeTable;
 private:
     TPoolAllocator& operator=(const TPoolAllocator&);  // don't allow assignment operator
     TPoolAllocator(const TPoolAllocator&);  // don't allow default copy constructor
@@ -253,6 +340,24 @@ private:
 extern TPoolAllocator& GetThreadPoolAllocator();
 void SetThreadPoolAllocator(TPoolAllocator* poolAllocator);
 
+//
+// Account the thread's pool allocations made during the lifetime of a
+// TPoolCategoryScope under 'category'.
+//
+class TPoolCategoryScope {
+public:
+    explicit TPoolCategoryScope(TPoolCategory category) :
+        pool(GetThreadPoolAllocator()), previous(pool.setCategory(category)) { }
+    ~TPoolCategoryScope() { pool.setCategory(previous); }
+
+private:
+    TPoolCategoryScope(const TPoolCategoryScope&);
+    TPoolCategoryScope& operator=(const TPoolCategoryScope&);
+
+    TPoolAllocator& pool;
+    TPoolCategory previous;
+};
+
 //
 // This STL compatible allocator is intended to be used as the allocator
 // parameter to templatized STL containers, like vector and map.
@@ -285,15 +390,15 @@ public:
         pool_allocator(const pool_allocator<Other>& p) : allocator(p.getAllocator()) { }
 
     pointer allocate(size_type n) {
-        return reinterpret_cast<pointer>(getAllocator().allocate(n * sizeof(T))); }
+        return reinterpret_cast<pointer>(getAllocator().allocate(n * sizeof(T), category())); }
     pointer allocate(size_type n, const void*) {
-        return reinterpret_cast<pointer>(getAllocator().allocate(n * sizeof(T))); }
+        return reinterpret_cast<pointer>(getAllocator().allocate(n * sizeof(T), category())); }
 
     void deallocate(void*, size_type) { }
     void deallocate(pointer, size_type) { }
 
     pointer _Charalloc(size_t n) {
-        return reinterpret_cast<pointer>(getAllocator().allocate(n)); }
+        return reinterpret_cast<pointer>(getAllocator().allocate(n, category())); }
 
     void construct(pointer p, const T& val) { new ((void *)p) T(val); }
     void destroy(pointer p) { p->T::~T(); }
@@ -308,6 +413,14 @@ public:
 
 protected:
     pool_allocator& operator=(const pool_allocator&) { return *this; }
+
+    // Characters are the contents of TStrings; anything else is accounted as
+    // the pool is currently accounting.
+    TPoolCategory category() const
+    {
+        return std::is_same<T, char>::value ? EPoolString : getAllocator().getCategory();
+    }
+
     TPoolAllocator& allocator;
 };
 
@@ -137,6 +137,7 @@ struct TSampler {   // misnomer now; includes images, textures without sampler,
 
     void clear()
     {
+        memset(this, 0, sizeof(*this));
         type = EbtVoid;
         dim = EsdNone;
         arrayed = false;
@@ -491,6 +492,7 @@ public:
 
     void clear()
     {
+        memset(this, 0, sizeof(*this));
         precision = EpqNone;
         invariant = false;
         makeTemporary();
@@ -2390,6 +2392,10 @@ public:
     // See if two types match in all ways (just the actual type, not qualification)
     bool operator==(const TType& right) const
     {
+        // nodes sharing their type through a TTypeTable share the instance
+        if (this == &right)
+            return true;
+
         return sameElementType(right) && sameArrayness(right) && sameTypeParameters(right);
     }
 
@@ -2410,6 +2416,10 @@ public:
     }
 
 protected:
+    friend class TSymbolTableSnapshotWriter;
+    friend class TSymbolTableSnapshotReader;
+    friend class TTypeTable;
+
     // Require consumer to pick between deep copy and shallow copy.
     TType(const TType& type);
     TType& operator=(const TType& type);
@@ -1107,40 +1107,131 @@ struct TIntermNodePair {
     TIntermNode* node2;
 };
 
+//
+// Hash-conses the types of typed nodes: while a TTypeTableScope is alive, the
+// typed nodes made in its pool that have the same type, field for field, share
+// one instance of it, which is never changed.  A node that changes its type,
+// through getWritableType() or getQualifier(), first gets a copy of its own.
+//
+class TTypeTable {
+public:
+    TTypeTable() : numTypes(0) { }
+
+    // The shared instance of 't'.
+    const TType* intern(const TType& t);
+
+protected:
+    TTypeTable(const TTypeTable&);
+    TTypeTable& operator=(const TTypeTable&);
+
+    // The fields of a type, without padding, to hash and compare as bytes.
+    struct TKey {
+        unsigned int shape;         // basic type, vector and matrix sizes, and flags
+        TSampler sampler;
+        TQualifier qualifier;
+        const void* pointers[5];    // shared by shallow copies
+    };
+    static void makeKey(const TType&, TKey&);
+
+    struct TSlot {
+        const TType* type;
+        unsigned long long hash;
+    };
+    TVector<TSlot> slots;   // open-addressed; a power of 2 in size, at most half full
+    size_t numTypes;
+};
+
+//
+// Shares the types of the typed nodes made in the thread's current pool during
+// the lifetime of a TTypeTableScope.  The pool must not be popped before the end
+// of that lifetime.
+//
+class TTypeTableScope {
+public:
+    TTypeTableScope() : pool(GetThreadPoolAllocator()), previous(pool.setTypeTable(&table)) { }
+    ~TTypeTableScope() { pool.setTypeTable(previous); }
+
+private:
+    TTypeTableScope(const TTypeTableScope&);
+    TTypeTableScope& operator=(const TTypeTableScope&);
+
+    TTypeTable table;
+    TPoolAllocator& pool;
+    TTypeTable* previous;
+};
+
 //
 // Intermediate class for nodes that have a type.
 //
 class TIntermTyped : public TIntermNode {
 public:
-    TIntermTyped(const TType& t) { type.shallowCopy(t); }
-    TIntermTyped(TBasicType basicType) { TType bt(basicType); type.shallowCopy(bt); }
+    TIntermTyped(const TType& t) : pool(&GetThreadPoolAllocator()) { shareType(t); }
+    TIntermTyped(TBasicType basicType) : pool(&GetThreadPoolAllocator()) { TType bt(basicType); shareType(bt); }
+    TIntermTyped(const TIntermTyped& copyOf) : TIntermNode(copyOf), pool(&GetThreadPoolAllocator())
+    {
+        if (copyOf.typeShared && copyOf.pool == pool) {
+            type = copyOf.type;
+            typeShared = true;
+        } else
+            copyType(*copyOf.type);
+    }
     virtual       TIntermTyped* getAsTyped()       { return this; }
     virtual const TIntermTyped* getAsTyped() const { return this; }
-    virtual void setType(const TType& t) { type.shallowCopy(t); }
-    virtual const TType& getType() const { return type; }
-    virtual TType& getWritableType() { return type; }
+    virtual void setType(const TType& t) { shareType(t); }
+    virtual const TType& getType() const { return *type; }
+    virtual TType& getWritableType()
+    {
+        if (typeShared)
+            copyType(*type);
+        return *const_cast<TType*>(type);
+    }
 
-    virtual TBasicType getBasicType() const { return type.getBasicType(); }
-    virtual TQualifier& getQualifier() { return type.getQualifier(); }
-    virtual const TQualifier& getQualifier() const { return type.getQualifier(); }
+    virtual TBasicType getBasicType() const { return type->getBasicType(); }
+    virtual TQualifier& getQualifier() { return getWritableType().getQualifier(); }
+    virtual const TQualifier& getQualifier() const { return type->getQualifier(); }
     virtual void propagatePrecision(TPrecisionQualifier);
-    virtual int getVectorSize() const { return type.getVectorSize(); }
-    virtual int getMatrixCols() const { return type.getMatrixCols(); }
-    virtual int getMatrixRows() const { return type.getMatrixRows(); }
-    virtual bool isMatrix() const { return type.isMatrix(); }
-    virtual bool isArray()  const { return type.isArray(); }
-    virtual bool isVector() const { return type.isVector(); }
-    virtual bool isScalar() const { return type.isScalar(); }
-    virtual bool isStruct() const { return type.isStruct(); }
-    virtual bool isFloatingDomain() const { return type.isFloatingDomain(); }
-    virtual bool isIntegerDomain() const { return type.isIntegerDomain(); }
-    bool isAtomic() const { return type.isAtomic(); }
-    bool isReference() const { return type.isReference(); }
-    TString getCompleteString() const { return type.getCompleteString(); }
+    virtual int getVectorSize() const { return type->getVectorSize(); }
+    virtual int getMatrixCols() const { return type->getMatrixCols(); }
+    virtual int getMatrixRows() const { return type->getMatrixRows(); }
+    virtual bool isMatrix() const { return type->isMatrix(); }
+    virtual bool isArray()  const { return type->isArray(); }
+    virtual bool isVector() const { return type->isVector(); }
+    virtual bool isScalar() const { return type->isScalar(); }
+    virtual bool isStruct() const { return type->isStruct(); }
+    virtual bool isFloatingDomain() const { return type->isFloatingDomain(); }
+    virtual bool isIntegerDomain() const { return type->isIntegerDomain(); }
+    bool isAtomic() const { return type->isAtomic(); }
+    bool isReference() const { return type->isReference(); }
+    TString getCompleteString() const { return type->getCompleteString(); }
 
 protected:
     TIntermTyped& operator=(const TIntermTyped&);
-    TType type;
+
+    // Take the instance of 't' shared through the node's pool's type table, or,
+    // without one, a copy of it.  The table is only used while its pool is the
+    // thread's current one, which it allocates from.
+    void shareType(const TType& t)
+    {
+        TTypeTable* table = pool->getTypeTable();
+        if (table != nullptr && pool == &GetThreadPoolAllocator()) {
+            type = table->intern(t);
+            typeShared = true;
+        } else
+            copyType(t);
+    }
+    // Copies go in the node's pool, not the thread's current one, which, e.g.,
+    // while linking, is a program's pool that may not live as long as the node.
+    void copyType(const TType& t)
+    {
+        TType* copy = new(pool->allocate(sizeof(TType))) TType;
+        copy->shallowCopy(t);
+        type = copy;
+        typeShared = false;
+    }
+
+    const TType* type;      // only changed through getWritableType(), which unshares it first
+    TPoolAllocator* pool;   // the one current when the node was made, which holds it and its type
+    bool typeShared;
 };
 
 //
@@ -1363,11 +1454,11 @@ public:
     void setOperationPrecision(TPrecisionQualifier p) { operationPrecision = p; }
     TPrecisionQualifier getOperationPrecision() const { return operationPrecision != EpqNone ?
                                                                                      operationPrecision :
-                                                                                     type.getQualifier().precision; }
+                                                                                     type->getQualifier().precision; }
     TString getCompleteString() const
     {
-        TString cs = type.getCompleteString();
-        if (getOperationPrecision() != type.getQualifier().precision) {
+        TString cs = type->getCompleteString();
+        if (getOperationPrecision() != type->getQualifier().precision) {
             cs += ", operation at ";
             cs += GetPrecisionQualifierString(getOperationPrecision());
         }
@@ -77,6 +77,206 @@ bool isInf(double x)
 
 const double pi = 3.1415926535897932384626433832795;
 
+//
+// Typed, batched folding.
+//
+// A constant array holds a run of components that all share one basic type, so
+// the common operators can pick that type once and then run a plain loop over
+// the whole run, rather than going through TConstUnion's per-component switch.
+// The arithmetic is exactly what the TConstUnion operators do, so results are
+// bit-identical to the component-at-a-time path.
+//
+
+struct TAddOp {
+    template<class T> T operator()(T left, T right) const { return left + right; }
+};
+
+struct TSubOp {
+    template<class T> T operator()(T left, T right) const { return left - right; }
+};
+
+struct TMulOp {
+    template<class T> T operator()(T left, T right) const { return left * right; }
+};
+
+struct TDivOp {
+    double operator()(double left, double right) const
+    {
+        if (right != 0.0)
+            return left / right;
+        else if (left > 0.0)
+            return (double)INFINITY;
+        else if (left < 0.0)
+            return -(double)INFINITY;
+        else
+            return (double)NAN;
+    }
+    int operator()(int left, int right) const
+    {
+        if (right == 0)
+            return 0x7FFFFFFF;
+        else if (right == -1 && left == (int)-0x80000000ll)
+            return (int)-0x80000000ll;
+        else
+            return left / right;
+    }
+    unsigned int operator()(unsigned int left, unsigned int right) const
+    {
+        if (right == 0u)
+            return 0xFFFFFFFFu;
+        else
+            return left / right;
+    }
+};
+
+// Apply 'op' to 'count' components. A stride of 0 repeats a scalar operand
+// across the run without smearing it into a new array first.
+//
+// Returns false, leaving 'result' untouched, for types that have no batched form.
+template<class Op>
+bool FoldComponentRun(Op op, const TConstUnionArray& left, int leftStride,
+                      const TConstUnionArray& right, int rightStride,
+                      TConstUnionArray& result, int count)
+{
+    if (count == 0 || left[0].getType() != right[0].getType())
+        return false;
+
+    switch (left[0].getType()) {
+    case EbtDouble:
+        for (int i = 0, l = 0, r = 0; i < count; ++i, l += leftStride, r += rightStride)
+            result[i].setDConst(op(left[l].getDConst(), right[r].getDConst()));
+        return true;
+    case EbtInt:
+        for (int i = 0, l = 0, r = 0; i < count; ++i, l += leftStride, r += rightStride)
+            result[i].setIConst(op(left[l].getIConst(), right[r].getIConst()));
+        return true;
+    case EbtUint:
+        for (int i = 0, l = 0, r = 0; i < count; ++i, l += leftStride, r += rightStride)
+            result[i].setUConst(op(left[l].getUConst(), right[r].getUConst()));
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool FoldComponentRun(TOperator op, const TConstUnionArray& left, int leftStride,
+                      const TConstUnionArray& right, int rightStride,
+                      TConstUnionArray& result, int count)
+{
+    switch (op) {
+    case EOpAdd:
+        return FoldComponentRun(TAddOp(), left, leftStride, right, rightStride, result, count);
+    case EOpSub:
+        return FoldComponentRun(TSubOp(), left, leftStride, right, rightStride, result, count);
+    case EOpMul:
+    case EOpVectorTimesScalar:
+    case EOpMatrixTimesScalar:
+        return FoldComponentRun(TMulOp(), left, leftStride, right, rightStride, result, count);
+    case EOpDiv:
+        return FoldComponentRun(TDivOp(), left, leftStride, right, rightStride, result, count);
+    default:
+        return false;
+    }
+}
+
+// Column-major matrix product of a 'leftRows' x 'inner' left operand and an
+// 'inner' x 'rightCols' right operand. A vector is a matrix with one column on
+// the right, or one row on the left. The operands are read out once into
+// plain doubles, and each sum is accumulated in the original order.
+void FoldMatrixProduct(const TConstUnionArray& left, int leftRows, int inner,
+                       const TConstUnionArray& right, int rightCols,
+                       TConstUnionArray& result)
+{
+    const int maxComponents = 4 * 4;
+    double leftValues[maxComponents];
+    double rightValues[maxComponents];
+    assert(leftRows * inner <= maxComponents && inner * rightCols <= maxComponents);
+    for (int i = 0; i < leftRows * inner; ++i)
+        leftValues[i] = left[i].getDConst();
+    for (int i = 0; i < inner * rightCols; ++i)
+        rightValues[i] = right[i].getDConst();
+
+    for (int row = 0; row < leftRows; ++row) {
+        for (int column = 0; column < rightCols; ++column) {
+            double sum = 0.0;
+            for (int i = 0; i < inner; ++i)
+                sum += leftValues[i * leftRows + row] * rightValues[column * inner + i];
+            result[column * leftRows + row].setDConst(sum);
+        }
+    }
+}
+
+// Fold the conversions between the core scalar types, choosing the conversion
+// once for the whole run.
+//
+// Returns false for conversions that have no batched form.
+bool FoldConversionRun(TOperator op, const TConstUnionArray& source, TConstUnionArray& result, int count)
+{
+    switch (op) {
+    case EOpConvIntToBool:
+        for (int i = 0; i < count; ++i)
+            result[i].setBConst(source[i].getIConst() != 0);
+        return true;
+    case EOpConvUintToBool:
+        for (int i = 0; i < count; ++i)
+            result[i].setBConst(source[i].getUConst() != 0);
+        return true;
+    case EOpConvBoolToInt:
+        for (int i = 0; i < count; ++i)
+            result[i].setIConst(source[i].getBConst());
+        return true;
+    case EOpConvBoolToUint:
+        for (int i = 0; i < count; ++i)
+            result[i].setUConst(source[i].getBConst());
+        return true;
+    case EOpConvIntToUint:
+        for (int i = 0; i < count; ++i)
+            result[i].setUConst(source[i].getIConst());
+        return true;
+    case EOpConvUintToInt:
+        for (int i = 0; i < count; ++i)
+            result[i].setIConst(source[i].getUConst());
+        return true;
+    case EOpConvFloatToBool:
+    case EOpConvDoubleToBool:
+        for (int i = 0; i < count; ++i)
+            result[i].setBConst(source[i].getDConst() != 0);
+        return true;
+    case EOpConvBoolToFloat:
+    case EOpConvBoolToDouble:
+        for (int i = 0; i < count; ++i)
+            result[i].setDConst(source[i].getBConst());
+        return true;
+    case EOpConvIntToFloat:
+    case EOpConvIntToDouble:
+        for (int i = 0; i < count; ++i)
+            result[i].setDConst(source[i].getIConst());
+        return true;
+    case EOpConvUintToFloat:
+    case EOpConvUintToDouble:
+        for (int i = 0; i < count; ++i)
+            result[i].setDConst(source[i].getUConst());
+        return true;
+    case EOpConvDoubleToFloat:
+    case EOpConvFloatToDouble:
+        for (int i = 0; i < count; ++i)
+            result[i].setDConst(source[i].getDConst());
+        return true;
+    case EOpConvFloatToUint:
+    case EOpConvDoubleToUint:
+        for (int i = 0; i < count; ++i)
+            result[i].setUConst(static_cast<unsigned int>(source[i].getDConst()));
+        return true;
+    case EOpConvFloatToInt:
+    case EOpConvDoubleToInt:
+        for (int i = 0; i < count; ++i)
+            result[i].setIConst(static_cast<int>(source[i].getDConst()));
+        return true;
+    default:
+        return false;
+    }
+}
+
 } // end anonymous namespace
 
 
@@ -116,6 +316,8 @@ TIntermTyped* TIntermConstantUnion::fold(TOperator op, const TIntermTyped* right
     // Figure out the size of the result
     int newComps;
     int constComps;
+    int leftStride = 1;
+    int rightStride = 1;
     switch(op) {
     case EOpMatrixTimesMatrix:
         newComps = rightNode->getMatrixCols() * getMatrixRows();
@@ -131,14 +333,11 @@ TIntermTyped* TIntermConstantUnion::fold(TOperator op, const TIntermTyped* right
         constComps = rightConstantNode->getType().computeNumComponents();
         if (constComps == 1 && newComps > 1) {
             // for a case like vec4 f = vec4(2,3,4,5) + 1.2;
-            TConstUnionArray smearedArray(newComps, rightNode->getConstArray()[0]);
-            rightUnionArray = smearedArray;
+            rightStride = 0;
         } else if (constComps > 1 && newComps == 1) {
             // for a case like vec4 f = 1.2 + vec4(2,3,4,5);
             newComps = constComps;
-            rightUnionArray = rightNode->getConstArray();
-            TConstUnionArray smearedArray(newComps, getConstArray()[0]);
-            leftUnionArray = smearedArray;
+            leftStride = 0;
             returnType.shallowCopy(rightNode->getType());
         }
         break;
@@ -147,6 +346,25 @@ TIntermTyped* TIntermConstantUnion::fold(TOperator op, const TIntermTyped* right
     TConstUnionArray newConstArray(newComps);
     TType constBool(EbtBool, EvqConst);
 
+    // The common arithmetic folds a whole run at once, repeating a scalar
+    // operand in place.
+    if (FoldComponentRun(op, leftUnionArray, leftStride, rightUnionArray, rightStride, newConstArray, newComps)) {
+        TIntermConstantUnion *newNode = new TIntermConstantUnion(newConstArray, returnType);
+        newNode->setLoc(getLoc());
+
+        return newNode;
+    }
+
+    // Everything else goes a component at a time, with a scalar operand
+    // smeared out to match the other.
+    if (rightStride == 0) {
+        TConstUnionArray smearedArray(newComps, rightUnionArray[0]);
+        rightUnionArray = smearedArray;
+    } else if (leftStride == 0) {
+        TConstUnionArray smearedArray(newComps, leftUnionArray[0]);
+        leftUnionArray = smearedArray;
+    }
+
     switch(op) {
     case EOpAdd:
         for (int i = 0; i < newComps; i++)
@@ -164,14 +382,8 @@ TIntermTyped* TIntermConstantUnion::fold(TOperator op, const TIntermTyped* right
             newConstArray[i] = leftUnionArray[i] * rightUnionArray[i];
         break;
     case EOpMatrixTimesMatrix:
-        for (int row = 0; row < getMatrixRows(); row++) {
-            for (int column = 0; column < rightNode->getMatrixCols(); column++) {
-                double sum = 0.0f;
-                for (int i = 0; i < rightNode->getMatrixRows(); i++)
-                    sum += leftUnionArray[i * getMatrixRows() + row].getDConst() * rightUnionArray[column * rightNode->getMatrixRows() + i].getDConst();
-                newConstArray[column * getMatrixRows() + row].setDConst(sum);
-            }
-        }
+        FoldMatrixProduct(leftUnionArray, getMatrixRows(), rightNode->getMatrixRows(),
+                          rightUnionArray, rightNode->getMatrixCols(), newConstArray);
         returnType.shallowCopy(TType(getType().getBasicType(), EvqConst, 0, rightNode->getMatrixCols(), getMatrixRows()));
         break;
     case EOpDiv:
@@ -262,24 +474,15 @@ TIntermTyped* TIntermConstantUnion::fold(TOperator op, const TIntermTyped* right
         break;
 
     case EOpMatrixTimesVector:
-        for (int i = 0; i < getMatrixRows(); i++) {
-            double sum = 0.0f;
-            for (int j = 0; j < rightNode->getVectorSize(); j++) {
-                sum += leftUnionArray[j*getMatrixRows() + i].getDConst() * rightUnionArray[j].getDConst();
-            }
-            newConstArray[i].setDConst(sum);
-        }
+        FoldMatrixProduct(leftUnionArray, getMatrixRows(), rightNode->getVectorSize(),
+                          rightUnionArray, 1, newConstArray);
 
         returnType.shallowCopy(TType(getBasicType(), EvqConst, getMatrixRows()));
         break;
 
     case EOpVectorTimesMatrix:
-        for (int i = 0; i < rightNode->getMatrixCols(); i++) {
-            double sum = 0.0f;
-            for (int j = 0; j < getVectorSize(); j++)
-                sum += leftUnionArray[j].getDConst() * rightUnionArray[i*rightNode->getMatrixRows() + j].getDConst();
-            newConstArray[i].setDConst(sum);
-        }
+        FoldMatrixProduct(leftUnionArray, 1, getVectorSize(),
+                          rightUnionArray, rightNode->getMatrixCols(), newConstArray);
 
         returnType.shallowCopy(TType(getBasicType(), EvqConst, rightNode->getMatrixCols()));
         break;
@@ -521,6 +724,10 @@ TIntermTyped* TIntermConstantUnion::fold(TOperator op, const TType& returnType)
     if (! componentWise)
         objectSize = 0;
 
+    // Conversions between the core types fold the whole run at once
+    if (FoldConversionRun(op, unionArray, newConstArray, objectSize))
+        objectSize = 0;
+
     // Process component-wise operations
     for (int i = 0; i < objectSize; i++) {
         switch (op) {
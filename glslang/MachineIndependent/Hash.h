@@ -0,0 +1,106 @@
+//
+// Copyright (C) 2020 The Khronos Group Inc.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//    Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+//    Redistributions in binary form must reproduce the above
+//    copyright notice, this list of conditions and the following
+//    disclaimer in the documentation and/or other materials provided
+//    with the distribution.
+//
+//    Neither the name of The Khronos Group Inc. nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef _GLSLANG_HASH_INCLUDED_
+#define _GLSLANG_HASH_INCLUDED_
+
+#include <cstddef>
+
+namespace glslang {
+
+//
+// FNV-1a.  Each takes the hash so far, to continue it, or the basis, to start
+// one.  The 32-bit form is for tables and checksums; the 64-bit form is for
+// hashes that are trusted without comparing what they hash.
+//
+const unsigned int FnvBasis = 2166136261u;
+const unsigned long long FnvBasis64 = 14695981039346656037ull;
+
+inline unsigned int HashFnv(unsigned int hash, const void* data, size_t size)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t b = 0; b < size; ++b) {
+        hash ^= bytes[b];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+// Hash a string up to its terminating 0, without finding its length first.
+inline unsigned int HashFnvString(unsigned int hash, const char* s)
+{
+    for (; *s != 0; ++s) {
+        hash ^= (unsigned char)*s;
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+inline unsigned long long HashFnv64(unsigned long long hash, const void* data, size_t size)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t b = 0; b < size; ++b) {
+        hash ^= bytes[b];
+        hash *= 1099511628211ull;
+    }
+
+    return hash;
+}
+
+//
+// Linear probing of an open-addressed table, whose size is a power of 2 and
+// which always has an empty slot.  Returns the first slot, from the one 'hash'
+// picks, that is empty or that 'matches'.  Pass NoMatch() to find where to add.
+//
+template<class Slots, class IsEmpty, class Matches>
+size_t ProbeSlots(const Slots& slots, size_t hash, IsEmpty isEmpty, Matches matches)
+{
+    const size_t mask = slots.size() - 1;
+    size_t slot = hash & mask;
+    while (! isEmpty(slots[slot]) && ! matches(slots[slot]))
+        slot = (slot + 1) & mask;
+
+    return slot;
+}
+
+struct NoMatch {
+    template<class Slot> bool operator()(const Slot&) const { return false; }
+};
+
+} // end namespace glslang
+
+#endif // _GLSLANG_HASH_INCLUDED_
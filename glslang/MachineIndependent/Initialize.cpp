@@ -8171,7 +8171,7 @@ void TBuiltIns::identifyBuiltIns(int version, EProfile profile, const SpvVersion
         }
 
         {
-            const char *coopExt[2] = { E_GL_NV_cooperative_matrix, E_GL_NV_integer_cooperative_matrix };
+            const TExtension coopExt[2] = { E_GL_NV_cooperative_matrix, E_GL_NV_integer_cooperative_matrix };
             symbolTable.setFunctionExtensions("coopMatLoadNV",   2, coopExt);
             symbolTable.setFunctionExtensions("coopMatStoreNV",  2, coopExt);
             symbolTable.setFunctionExtensions("coopMatMulAddNV", 2, coopExt);
@@ -8199,7 +8199,7 @@ void TBuiltIns::identifyBuiltIns(int version, EProfile profile, const SpvVersion
     case EShLangMiss:
     case EShLangCallable:
         if (profile != EEsProfile && version >= 460) {
-            const char *rtexts[] = { E_GL_NV_ray_tracing, E_GL_EXT_ray_tracing };
+            const TExtension rtexts[] = { E_GL_NV_ray_tracing, E_GL_EXT_ray_tracing };
             symbolTable.setVariableExtensions("gl_LaunchIDNV", 1, &E_GL_NV_ray_tracing);
             symbolTable.setVariableExtensions("gl_LaunchIDEXT", 1, &E_GL_EXT_ray_tracing);
             symbolTable.setVariableExtensions("gl_LaunchSizeNV", 1, &E_GL_NV_ray_tracing);
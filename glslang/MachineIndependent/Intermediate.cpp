@@ -44,6 +44,7 @@
 #include "RemoveTree.h"
 #include "SymbolTable.h"
 #include "propagateNoContraction.h"
+#include "Hash.h"
 
 #include <cfloat>
 #include <utility>
@@ -3793,6 +3794,68 @@ void TIntermBinary::updatePrecision()
     }
 }
 
+//
+// Types are hashed and compared through a key copying their fields into
+// storage without padding.  TSampler and TQualifier are copied whole, which is
+// enough, as they zero all their bits when cleared.
+//
+void TTypeTable::makeKey(const TType& type, TKey& key)
+{
+    static_assert(sizeof(TKey) == sizeof(unsigned int) + sizeof(TSampler) + sizeof(TQualifier) +
+                                  sizeof(key.pointers), "TKey must not have padding");
+
+    key.shape = (unsigned int)type.basicType | (unsigned int)(type.vectorSize & 0xf) << 8 |
+                (unsigned int)(type.matrixCols & 0xf) << 12 | (unsigned int)(type.matrixRows & 0xf) << 16 |
+                (unsigned int)type.vector1 << 20 | (unsigned int)type.coopmat << 21;
+    memcpy(&key.sampler, &type.sampler, sizeof(TSampler));
+    memcpy(&key.qualifier, &type.qualifier, sizeof(TQualifier));
+    key.pointers[0] = type.arraySizes;
+    key.pointers[1] = type.isStruct() ? (const void*)type.structure : (const void*)type.referentType;
+    key.pointers[2] = type.fieldName;
+    key.pointers[3] = type.typeName;
+    key.pointers[4] = type.typeParameters;
+}
+
+const TType* TTypeTable::intern(const TType& t)
+{
+    TKey key;
+    makeKey(t, key);
+
+    // FNV-1a, mixed down into the low bits the table uses
+    unsigned long long hash = HashFnv64(FnvBasis64, &key, sizeof(key));
+    hash ^= hash >> 32;
+    hash *= 0x9e3779b97f4a7c15ull;
+    hash ^= hash >> 29;
+    const auto isEmptySlot = [](const TSlot& slot) { return slot.type == nullptr; };
+
+    if (numTypes + 1 > slots.size() / 2) {
+        TVector<TSlot> grown(std::max((size_t)64, slots.size() * 2), TSlot{ nullptr, 0 });
+        slots.swap(grown);
+        for (const TSlot& slot : grown) {
+            if (slot.type != nullptr)
+                slots[ProbeSlots(slots, (size_t)slot.hash, isEmptySlot, NoMatch())] = slot;
+        }
+    }
+
+    size_t s = ProbeSlots(slots, (size_t)hash, isEmptySlot, [&](const TSlot& slot) {
+        if (slot.hash != hash)
+            return false;
+        TKey slotKey;
+        makeKey(*slot.type, slotKey);
+        return memcmp(&slotKey, &key, sizeof(TKey)) == 0;
+    });
+    if (slots[s].type != nullptr)
+        return slots[s].type;
+
+    TType* type = new TType;
+    type->shallowCopy(t);
+    slots[s].type = type;
+    slots[s].hash = hash;
+    ++numTypes;
+
+    return type;
+}
+
 void TIntermTyped::propagatePrecision(TPrecisionQualifier newPrecision)
 {
     if (getQualifier().precision != EpqNone || (getBasicType() != EbtInt && getBasicType() != EbtUint && getBasicType() != EbtFloat && getBasicType() != EbtFloat16))
@@ -293,7 +293,7 @@ void TParseContext::handlePragma(const TSourceLoc& loc, const TVector<TString>&
             error(loc, "requires SPIR-V 1.3", "#pragma use_variable_pointers", "");
         intermediate.setUseVariablePointers();
     } else if (tokens[0].compare("once") == 0) {
-        warn(loc, "not implemented", "#pragma once", "");
+        // handled by the preprocessor, for included files
     } else if (tokens[0].compare("glslang_binary_double_output") == 0)
         intermediate.setBinaryDoubleOutput();
 #endif
@@ -2135,7 +2135,7 @@ void TParseContext::builtInOpCheck(const TSourceLoc& loc, const TFunction& fnCan
             requireExtensions(loc, 1, &E_GL_KHR_memory_scope_semantics, fnCandidate.getName().c_str());
             memorySemanticsCheck(loc, fnCandidate, callNode);
         } else if (arg0->getType().getBasicType() == EbtInt64 || arg0->getType().getBasicType() == EbtUint64) {
-            const char* const extensions[2] = { E_GL_NV_shader_atomic_int64,
+            const TExtension extensions[2] = { E_GL_NV_shader_atomic_int64,
                                                 E_GL_EXT_shader_atomic_int64 };
             requireExtensions(loc, 2, extensions, fnCandidate.getName().c_str());
         }
@@ -2278,25 +2278,32 @@ void TParseContext::builtInOpCheck(const TSourceLoc& loc, const TFunction& fnCan
             error(loc, "requires SPIR-V 1.3", "subgroup op", "");
 
         // Check that if extended types are being used that the correct extensions are enabled.
+        // The type's complete string only describes the feature in diagnostics, so it is
+        // not built when the extension is already enabled.
         if (arg0 != nullptr) {
             const TType& type = arg0->getType();
+            const auto requireTypeExtension = [&](TExtension extension) {
+                TExtensionBehavior behavior = getExtensionBehavior(extension);
+                if (behavior != EBhEnable && behavior != EBhRequire)
+                    requireExtensions(loc, 1, &extension, type.getCompleteString().c_str());
+            };
             switch (type.getBasicType()) {
             default:
                 break;
             case EbtInt8:
             case EbtUint8:
-                requireExtensions(loc, 1, &E_GL_EXT_shader_subgroup_extended_types_int8, type.getCompleteString().c_str());
+                requireTypeExtension(E_GL_EXT_shader_subgroup_extended_types_int8);
                 break;
             case EbtInt16:
             case EbtUint16:
-                requireExtensions(loc, 1, &E_GL_EXT_shader_subgroup_extended_types_int16, type.getCompleteString().c_str());
+                requireTypeExtension(E_GL_EXT_shader_subgroup_extended_types_int16);
                 break;
             case EbtInt64:
             case EbtUint64:
-                requireExtensions(loc, 1, &E_GL_EXT_shader_subgroup_extended_types_int64, type.getCompleteString().c_str());
+                requireTypeExtension(E_GL_EXT_shader_subgroup_extended_types_int64);
                 break;
             case EbtFloat16:
-                requireExtensions(loc, 1, &E_GL_EXT_shader_subgroup_extended_types_float16, type.getCompleteString().c_str());
+                requireTypeExtension(E_GL_EXT_shader_subgroup_extended_types_float16);
                 break;
             }
         }
@@ -5221,7 +5228,7 @@ void TParseContext::setLayoutQualifier(const TSourceLoc& loc, TPublicType& publi
         const char* feature = "offset";
         if (spvVersion.spv == 0) {
             requireProfile(loc, EEsProfile | ECoreProfile | ECompatibilityProfile, feature);
-            const char* exts[2] = { E_GL_ARB_enhanced_layouts, E_GL_ARB_shader_atomic_counters };
+            const TExtension exts[2] = { E_GL_ARB_enhanced_layouts, E_GL_ARB_shader_atomic_counters };
             profileRequires(loc, ECoreProfile | ECompatibilityProfile, 420, 2, exts, feature);
             profileRequires(loc, EEsProfile, 310, nullptr, feature);
         }
@@ -5246,7 +5253,7 @@ void TParseContext::setLayoutQualifier(const TSourceLoc& loc, TPublicType& publi
         return;
     } else if (id == "location") {
         profileRequires(loc, EEsProfile, 300, nullptr, "location");
-        const char* exts[2] = { E_GL_ARB_separate_shader_objects, E_GL_ARB_explicit_attrib_location }; 
+        const TExtension exts[2] = { E_GL_ARB_separate_shader_objects, E_GL_ARB_explicit_attrib_location }; 
         // GL_ARB_explicit_uniform_location requires 330 or GL_ARB_explicit_attrib_location we do not need to add it here
         profileRequires(loc, ~EEsProfile, 330, 2, exts, "location");
         if ((unsigned int)value >= TQualifier::layoutLocationEnd)
@@ -5440,7 +5447,7 @@ void TParseContext::setLayoutQualifier(const TSourceLoc& loc, TPublicType& publi
     case EShLangFragment:
         if (id == "index") {
             requireProfile(loc, ECompatibilityProfile | ECoreProfile | EEsProfile, "index layout qualifier on fragment output");
-            const char* exts[2] = { E_GL_ARB_separate_shader_objects, E_GL_ARB_explicit_attrib_location };
+            const TExtension exts[2] = { E_GL_ARB_separate_shader_objects, E_GL_ARB_explicit_attrib_location };
             profileRequires(loc, ECompatibilityProfile | ECoreProfile, 330, 2, exts, "index layout qualifier on fragment output");
             profileRequires(loc, EEsProfile ,310, E_GL_EXT_blend_func_extended, "index layout qualifier on fragment output");
             // "It is also a compile-time error if a fragment shader sets a layout index to less than 0 or greater than 1."
@@ -5972,7 +5979,7 @@ void TParseContext::layoutQualifierCheck(const TSourceLoc& loc, const TQualifier
             else
                 requireStage(loc, (EShLanguageMask)~EShLangComputeMask, feature);
             if (language == EShLangVertex) {
-                const char* exts[2] = { E_GL_ARB_separate_shader_objects, E_GL_ARB_explicit_attrib_location };
+                const TExtension exts[2] = { E_GL_ARB_separate_shader_objects, E_GL_ARB_explicit_attrib_location };
                 profileRequires(loc, ~EEsProfile, 330, 2, exts, feature);
                 profileRequires(loc, EEsProfile, 300, nullptr, feature);
             } else {
@@ -5989,7 +5996,7 @@ void TParseContext::layoutQualifierCheck(const TSourceLoc& loc, const TQualifier
             else
                 requireStage(loc, (EShLanguageMask)~EShLangComputeMask, feature);
             if (language == EShLangFragment) {
-                const char* exts[2] = { E_GL_ARB_separate_shader_objects, E_GL_ARB_explicit_attrib_location };
+                const TExtension exts[2] = { E_GL_ARB_separate_shader_objects, E_GL_ARB_explicit_attrib_location };
                 profileRequires(loc, ~EEsProfile, 330, 2, exts, feature);
                 profileRequires(loc, EEsProfile, 300, nullptr, feature);
             } else {
@@ -6182,6 +6189,22 @@ const TFunction* TParseContext::findFunction(const TSourceLoc& loc, const TFunct
             return symbol->getAsFunction();
     }
 
+    // Reuse the resolution of an earlier call of the same signature to a built-in.
+    // Structure and cooperative matrix arguments compare by more than their mangled
+    // names, so calls with them are always resolved afresh.
+    bool reusable = ! symbolTable.hasUserFunctionName(call.getName());
+    for (int i = 0; i < call.getParamCount() && reusable; ++i)
+        reusable = ! call[i].type->isStruct() && ! call[i].type->isCoopMat();
+    if (reusable) {
+        auto resolution = builtInResolutions.find(call.getMangledName());
+        if (resolution != builtInResolutions.end()) {
+            builtIn = true;
+            intermediate.addBuiltInResolution(true);
+            return resolution->second;
+        }
+    }
+    int numErrorsBefore = getNumErrors();
+
     bool explicitTypesEnabled = extensionTurnedOn(E_GL_EXT_shader_explicit_arithmetic_types) ||
                                 extensionTurnedOn(E_GL_EXT_shader_explicit_arithmetic_types_int8) ||
                                 extensionTurnedOn(E_GL_EXT_shader_explicit_arithmetic_types_int16) ||
@@ -6203,9 +6226,26 @@ const TFunction* TParseContext::findFunction(const TSourceLoc& loc, const TFunct
     else
         function = findFunction400(loc, call, builtIn);
 
+    // only keep resolutions that were found without complaint
+    if (function != nullptr && builtIn) {
+        intermediate.addBuiltInResolution(false);
+        if (reusable && getNumErrors() == numErrorsBefore)
+            builtInResolutions[call.getMangledName()] = function;
+    }
+
     return function;
 }
 
+#ifndef GLSLANG_WEB
+// Extensions change which arguments convert to which parameters, so forget
+// the resolutions made under the previous ones.
+void TParseContext::updateExtensionBehavior(const char* const extension, TExtensionBehavior behavior)
+{
+    builtInResolutions.clear();
+    TParseContextBase::updateExtensionBehavior(extension, behavior);
+}
+#endif
+
 // Function finding algorithm for ES and desktop 110.
 const TFunction* TParseContext::findFunctionExact(const TSourceLoc& loc, const TFunction& call, bool& builtIn)
 {
@@ -7720,7 +7760,7 @@ void TParseContext::declareBlock(const TSourceLoc& loc, TTypeList& typeList, con
 // with a particular stage.
 void TParseContext::blockStageIoCheck(const TSourceLoc& loc, const TQualifier& qualifier)
 {
-    const char *extsrt[2] = { E_GL_NV_ray_tracing, E_GL_EXT_ray_tracing };
+    const TExtension extsrt[2] = { E_GL_NV_ray_tracing, E_GL_EXT_ray_tracing };
     switch (qualifier.storage) {
     case EvqUniform:
         profileRequires(loc, EEsProfile, 300, nullptr, "uniform block");
@@ -407,6 +407,10 @@ public:
     const TFunction* findFunction120(const TSourceLoc& loc, const TFunction& call, bool& builtIn);
     const TFunction* findFunction400(const TSourceLoc& loc, const TFunction& call, bool& builtIn);
     const TFunction* findFunctionExplicitTypes(const TSourceLoc& loc, const TFunction& call, bool& builtIn);
+#ifndef GLSLANG_WEB
+    using TParseContextBase::updateExtensionBehavior;
+    void updateExtensionBehavior(const char* const extension, TExtensionBehavior) override;
+#endif
     void declareTypeDefaults(const TSourceLoc&, const TPublicType&);
     TIntermNode* declareVariable(const TSourceLoc&, TString& identifier, const TPublicType&, TArraySizes* typeArray = 0, TIntermTyped* initializer = 0);
     TIntermTyped* addConstructor(const TSourceLoc&, TIntermNode*, const TType&);
@@ -525,6 +529,12 @@ protected:
     //
     TVector<TSymbol*> ioArraySymbolResizeList;
 #endif
+
+    // Built-in functions that calls resolved to, by the mangled name of the call.
+    // A resolution depends only on the call's signature, the language version and
+    // the extensions in effect, as long as no user function of the name hides the
+    // built-ins, so it is reused for later calls of the same signature.
+    TUnorderedMap<TString, const TFunction*> builtInResolutions;
 };
 
 } // end namespace glslang
@@ -38,33 +38,262 @@
 #include "../Include/InitializeGlobals.h"
 #include "../OSDependent/osinclude.h"
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
 namespace glslang {
 
+#ifdef ENABLE_THREAD_LOCAL
+// The thread-specific current pool, in native TLS, which is much cheaper to
+// reach than through the OS TLS calls.  Every pool allocation looks it up.
+thread_local TPoolAllocator* ThreadPoolAllocator = nullptr;
+#else
 // Process-wide TLS index
 OS_TLSIndex PoolIndex;
+#endif
 
 // Return the thread-specific current pool.
 TPoolAllocator& GetThreadPoolAllocator()
 {
+#ifdef ENABLE_THREAD_LOCAL
+    return *ThreadPoolAllocator;
+#else
     return *static_cast<TPoolAllocator*>(OS_GetTLSValue(PoolIndex));
+#endif
 }
 
 // Set the thread-specific current pool.
 void SetThreadPoolAllocator(TPoolAllocator* poolAllocator)
 {
+#ifdef ENABLE_THREAD_LOCAL
+    ThreadPoolAllocator = poolAllocator;
+#else
     OS_SetTLSValue(PoolIndex, poolAllocator);
+#endif
 }
 
 // Process-wide set up of the TLS pool storage.
 bool InitializePoolIndex()
 {
+#ifndef ENABLE_THREAD_LOCAL
     // Allocate a TLS index.
     if ((PoolIndex = OS_AllocTLSIndex()) == OS_INVALID_TLS_INDEX)
         return false;
+#endif
 
     return true;
 }
 
+namespace {
+
+//
+// Recycling of pages across pools.
+//
+// A pool keeps the pages it pops for itself, but a destroyed pool's pages used
+// to go straight back to the system, to be allocated again by the next shader's
+// pool.  Instead, pages of the default size are kept in a per-thread cache, up
+// to a limit, and new pages are taken from there first.
+//
+
+const size_t CachedPageSize = 8 * 1024;          // the default TPoolAllocator page size
+const size_t HugePageArenaSize = 2 * 1024 * 1024;
+
+std::atomic<size_t> PageCacheLimit(512);          // in pages; 4 MB
+std::atomic<bool> UseHugePages(false);
+
+std::atomic<size_t> PagesLive(0);
+std::atomic<size_t> PagesCached(0);
+std::atomic<size_t> BytesAllocated(0);
+
+struct TCachedPage {
+    TCachedPage* next;
+};
+
+// Huge-page backed arenas, shared by all threads, carved into pages.  Their
+// pages never go back to the system; pages not wanted by a cache are kept on
+// ArenaFreeList instead.
+std::mutex ArenaMutex;
+std::vector<char*> Arenas;
+size_t ArenaOffset = HugePageArenaSize;            // offset of the next page in Arenas.back()
+TCachedPage* ArenaFreeList = nullptr;
+std::atomic<bool> HaveArenas(false);
+
+void* NewArenaPage()
+{
+    std::lock_guard<std::mutex> guard(ArenaMutex);
+
+    if (ArenaFreeList != nullptr) {
+        TCachedPage* page = ArenaFreeList;
+        ArenaFreeList = page->next;
+        return page;
+    }
+
+    if (ArenaOffset + CachedPageSize > HugePageArenaSize) {
+        char* arena = static_cast<char*>(OS_AllocHugePageArena(HugePageArenaSize));
+        if (arena == nullptr)
+            return nullptr;
+        Arenas.push_back(arena);
+        ArenaOffset = 0;
+        HaveArenas = true;
+    }
+
+    char* page = Arenas.back() + ArenaOffset;
+    ArenaOffset += CachedPageSize;
+
+    return page;
+}
+
+// Give a page back to where it came from: an arena or the system.
+void FreePage(void* page)
+{
+    if (HaveArenas) {
+        std::lock_guard<std::mutex> guard(ArenaMutex);
+        for (char* arena : Arenas) {
+            if (page >= arena && page < arena + HugePageArenaSize) {
+                TCachedPage* cached = static_cast<TCachedPage*>(page);
+                cached->next = ArenaFreeList;
+                ArenaFreeList = cached;
+                return;
+            }
+        }
+    }
+
+    delete [] static_cast<char*>(page);
+}
+
+class TPageCache {
+public:
+    TPageCache() : pages(nullptr), count(0) { }
+    ~TPageCache() { trim(0); }
+
+    // Returns nullptr if the cache is empty.
+    void* take()
+    {
+        if (pages == nullptr)
+            return nullptr;
+
+        TCachedPage* page = pages;
+        pages = page->next;
+        --count;
+        --PagesCached;
+
+        return page;
+    }
+
+    void give(void* page)
+    {
+        TCachedPage* cached = static_cast<TCachedPage*>(page);
+        cached->next = pages;
+        pages = cached;
+        ++count;
+        ++PagesCached;
+
+        trim(PageCacheLimit);
+    }
+
+    void trim(size_t limit)
+    {
+        while (count > limit)
+            FreePage(take());
+    }
+
+private:
+    TCachedPage* pages;
+    size_t count;
+};
+
+#ifdef ENABLE_THREAD_LOCAL
+thread_local TPageCache ThreadPageCache;
+
+void* TakeCachedPage()
+{
+    return ThreadPageCache.take();
+}
+
+void CachePage(void* page)
+{
+    ThreadPageCache.give(page);
+}
+#else
+// Without native TLS, one cache is shared by all threads.
+std::mutex PageCacheMutex;
+TPageCache ProcessPageCache;
+
+void* TakeCachedPage()
+{
+    std::lock_guard<std::mutex> guard(PageCacheMutex);
+    return ProcessPageCache.take();
+}
+
+void CachePage(void* page)
+{
+    std::lock_guard<std::mutex> guard(PageCacheMutex);
+    ProcessPageCache.give(page);
+}
+#endif
+
+} // end anonymous namespace
+
+void TPoolAllocator::setPageCacheLimit(size_t bytes)
+{
+    PageCacheLimit = bytes / CachedPageSize;
+#ifdef ENABLE_THREAD_LOCAL
+    ThreadPageCache.trim(PageCacheLimit);
+#else
+    std::lock_guard<std::mutex> guard(PageCacheMutex);
+    ProcessPageCache.trim(PageCacheLimit);
+#endif
+}
+
+void TPoolAllocator::setHugePages(bool hugePages)
+{
+    UseHugePages = hugePages;
+}
+
+void TPoolAllocator::getCounters(size_t& pagesLive, size_t& pagesCached, size_t& bytesAllocated)
+{
+    pagesLive = PagesLive;
+    pagesCached = PagesCached;
+    bytesAllocated = BytesAllocated;
+}
+
+// Get a new single page, from the page cache if possible.
+TPoolAllocator::tHeader* TPoolAllocator::newPage()
+{
+    void* page = nullptr;
+    if (pageSize == CachedPageSize) {
+        page = TakeCachedPage();
+        if (page == nullptr && UseHugePages)
+            page = NewArenaPage();
+    }
+    if (page == nullptr)
+        page = ::new char[pageSize];
+    ++PagesLive;
+
+    return reinterpret_cast<tHeader*>(page);
+}
+
+// Free a page, single or multi-page, to the page cache if possible.
+void TPoolAllocator::deletePage(tHeader* page, size_t pageCount)
+{
+    PagesLive -= pageCount;
+    if (pageCount == 1 && pageSize == CachedPageSize)
+        CachePage(page);
+    else
+        delete [] reinterpret_cast<char*>(page);
+}
+
+void TPoolAllocator::reportBytes()
+{
+    size_t totalBytes = poppedBytes;
+    for (int c = 0; c < EPoolCategoryCount; ++c)
+        totalBytes += categoryBytes[c];
+
+    BytesAllocated += totalBytes - reportedBytes;
+    reportedBytes = totalBytes;
+}
+
 //
 // Implement the functionality of the TPoolAllocator class, which
 // is documented in PoolAlloc.h.
@@ -74,8 +303,19 @@ TPoolAllocator::TPoolAllocator(int growthIncrement, int allocationAlignment) :
     alignment(allocationAlignment),
     freeList(nullptr),
     inUseList(nullptr),
-    numCalls(0)
+    numCalls(0),
+    poppedBytes(0),
+    reportedBytes(0),
+    currentCategory(EPoolAst),
+    pagesHeld(0),
+    peakPagesHeld(0),
+    typeTable(nullptr)
 {
+    for (int c = 0; c < EPoolCategoryCount; ++c) {
+        categoryBytes[c] = 0;
+        peakCategoryBytes[c] = 0;
+    }
+
     //
     // Don't allow page sizes we know are smaller than all common
     // OS page sizes.
@@ -116,10 +356,13 @@ TPoolAllocator::TPoolAllocator(int growthIncrement, int allocationAlignment) :
 
 TPoolAllocator::~TPoolAllocator()
 {
+    reportBytes();
+
     while (inUseList) {
         tHeader* next = inUseList->nextPage;
+        size_t pageCount = inUseList->pageCount;
         inUseList->~tHeader();
-        delete [] reinterpret_cast<char*>(inUseList);
+        deletePage(inUseList, pageCount);
         inUseList = next;
     }
 
@@ -132,7 +375,7 @@ TPoolAllocator::~TPoolAllocator()
     //
     while (freeList) {
         tHeader* next = freeList->nextPage;
-        delete [] reinterpret_cast<char*>(freeList);
+        deletePage(freeList, 1);
         freeList = next;
     }
 }
@@ -175,7 +418,11 @@ void TAllocation::checkGuardBlock(unsigned char*, unsigned char, const char*) co
 
 void TPoolAllocator::push()
 {
-    tAllocState state = { currentPageOffset, inUseList };
+    tAllocState state;
+    state.offset = currentPageOffset;
+    state.page = inUseList;
+    for (int c = 0; c < EPoolCategoryCount; ++c)
+        state.categoryBytes[c] = categoryBytes[c];
 
     stack.push_back(state);
 
@@ -200,6 +447,13 @@ void TPoolAllocator::pop()
     tHeader* page = stack.back().page;
     currentPageOffset = stack.back().offset;
 
+    for (int c = 0; c < EPoolCategoryCount; ++c) {
+        if (categoryBytes[c] > peakCategoryBytes[c])
+            peakCategoryBytes[c] = categoryBytes[c];
+        poppedBytes += categoryBytes[c] - stack.back().categoryBytes[c];
+        categoryBytes[c] = stack.back().categoryBytes[c];
+    }
+
     while (inUseList != page) {
         tHeader* nextInUse = inUseList->nextPage;
         size_t pageCount = inUseList->pageCount;
@@ -209,7 +463,8 @@ void TPoolAllocator::pop()
         inUseList->~tHeader(); // currently, just a debug allocation checker
 
         if (pageCount > 1) {
-            delete [] reinterpret_cast<char*>(inUseList);
+            deletePage(inUseList, pageCount);
+            pagesHeld -= pageCount;
         } else {
             inUseList->nextPage = freeList;
             freeList = inUseList;
@@ -230,7 +485,25 @@ void TPoolAllocator::popAll()
         pop();
 }
 
-void* TPoolAllocator::allocate(size_t numBytes)
+TPoolUsage TPoolAllocator::getUsage(TPoolCategory category) const
+{
+    TPoolUsage usage;
+    usage.current = categoryBytes[category];
+    usage.peak = std::max(peakCategoryBytes[category], categoryBytes[category]);
+
+    return usage;
+}
+
+TPoolUsage TPoolAllocator::getPageUsage() const
+{
+    TPoolUsage usage;
+    usage.current = pagesHeld * pageSize;
+    usage.peak = peakPagesHeld * pageSize;
+
+    return usage;
+}
+
+void* TPoolAllocator::allocate(size_t numBytes, TPoolCategory category)
 {
     // If we are using guard blocks, all allocations are bracketed by
     // them: [guardblock][allocation][guardblock].  numBytes is how
@@ -243,7 +516,7 @@ void* TPoolAllocator::allocate(size_t numBytes)
     // Just keep some interesting statistics.
     //
     ++numCalls;
-    totalBytes += numBytes;
+    categoryBytes[category] += numBytes;
 
     //
     // Do the allocation, most likely case first, for efficiency.
@@ -273,6 +546,10 @@ void* TPoolAllocator::allocate(size_t numBytes)
         // Use placement-new to initialize header
         new(memory) tHeader(inUseList, (numBytesToAlloc + pageSize - 1) / pageSize);
         inUseList = memory;
+        PagesLive += memory->pageCount;
+        pagesHeld += memory->pageCount;
+        peakPagesHeld = std::max(peakPagesHeld, pagesHeld);
+        reportBytes();
 
         currentPageOffset = pageSize;  // make next allocation come from a new page
 
@@ -288,10 +565,13 @@ void* TPoolAllocator::allocate(size_t numBytes)
         memory = freeList;
         freeList = freeList->nextPage;
     } else {
-        memory = reinterpret_cast<tHeader*>(::new char[pageSize]);
+        memory = newPage();
         if (memory == 0)
             return 0;
+        ++pagesHeld;
+        peakPagesHeld = std::max(peakPagesHeld, pagesHeld);
     }
+    reportBytes();
 
     // Use placement-new to initialize header
     new(memory) tHeader(inUseList, 1);
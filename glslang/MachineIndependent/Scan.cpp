@@ -41,9 +41,19 @@
 // GLSL scanning, leveraging the scanning done by the preprocessor.
 //
 
+#include <cstdint>
 #include <cstring>
-#include <unordered_map>
-#include <unordered_set>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define GLSLANG_SCAN_SSE2
+    #include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+    #define GLSLANG_SCAN_NEON
+    #include <arm_neon.h>
+#endif
+#if defined(_MSC_VER) && (defined(GLSLANG_SCAN_SSE2) || defined(GLSLANG_SCAN_NEON))
+    #include <intrin.h>
+#endif
 
 #include "../Include/Types.h"
 #include "SymbolTable.h"
@@ -62,6 +72,255 @@ int yylex(YYSTYPE*, glslang::TParseContext&);
 
 namespace glslang {
 
+namespace {
+
+//
+// Searching runs of source characters in bulk, 16 at a time where SSE2 or NEON
+// is available.  Each chunk of characters is compared to give a mask with a bit
+// set for each character found, lowest bit for the first character.
+//
+
+#if defined(GLSLANG_SCAN_SSE2)
+
+typedef __m128i TChunk;
+typedef unsigned int TChunkMask;
+const int BitsPerChar = 1;
+
+inline TChunk Load(const unsigned char* text) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(text)); }
+inline TChunk Or(TChunk a, TChunk b) { return _mm_or_si128(a, b); }
+inline TChunk Equal(TChunk chunk, unsigned char c) { return _mm_cmpeq_epi8(chunk, _mm_set1_epi8((char)c)); }
+
+// lo <= character <= hi, as unsigned
+inline TChunk InRange(TChunk chunk, unsigned char lo, unsigned char hi)
+{
+    TChunk offset = _mm_sub_epi8(chunk, _mm_set1_epi8((char)lo));
+    return _mm_cmpeq_epi8(_mm_min_epu8(offset, _mm_set1_epi8((char)(hi - lo))), offset);
+}
+
+inline TChunkMask Found(TChunk chunk) { return (TChunkMask)_mm_movemask_epi8(chunk); }
+inline TChunkMask NotFound(TChunk chunk) { return Found(chunk) ^ 0xFFFF; }
+
+inline int LowestBit(TChunkMask mask)
+{
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return (int)index;
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+#elif defined(GLSLANG_SCAN_NEON)
+
+typedef uint8x16_t TChunk;
+typedef uint64_t TChunkMask;
+const int BitsPerChar = 4;      // only the top one of the four is kept in masks
+
+inline TChunk Load(const unsigned char* text) { return vld1q_u8(text); }
+inline TChunk Or(TChunk a, TChunk b) { return vorrq_u8(a, b); }
+inline TChunk Equal(TChunk chunk, unsigned char c) { return vceqq_u8(chunk, vdupq_n_u8(c)); }
+
+inline TChunk InRange(TChunk chunk, unsigned char lo, unsigned char hi)
+{
+    return vandq_u8(vcgeq_u8(chunk, vdupq_n_u8(lo)), vcleq_u8(chunk, vdupq_n_u8(hi)));
+}
+
+inline TChunkMask Found(TChunk chunk)
+{
+    uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(chunk), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0) & 0x8888888888888888ull;
+}
+inline TChunkMask NotFound(TChunk chunk) { return Found(vmvnq_u8(chunk)); }
+
+inline int LowestBit(TChunkMask mask)
+{
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward64(&index, mask);
+    return (int)index;
+#else
+    return __builtin_ctzll(mask);
+#endif
+}
+
+#endif
+
+#if defined(GLSLANG_SCAN_SSE2) || defined(GLSLANG_SCAN_NEON)
+const size_t ChunkSize = 16;
+#endif
+
+inline bool IsSpace(unsigned char c) { return c == ' ' || c == '\t'; }
+inline bool IsLineCommentStop(unsigned char c) { return c == '\n' || c == '\r' || c == '\\'; }
+inline bool IsBlockCommentStop(unsigned char c) { return c == '*' || c == '\\'; }
+inline bool IsIdentifierChar(unsigned char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+// Return the length of the run of spaces and tabs starting 'text'.
+size_t FindSpacesEnd(const unsigned char* text, size_t length)
+{
+    size_t i = 0;
+#if defined(GLSLANG_SCAN_SSE2) || defined(GLSLANG_SCAN_NEON)
+    for (; i + ChunkSize <= length; i += ChunkSize) {
+        TChunk chunk = Load(text + i);
+        TChunkMask others = NotFound(Or(Equal(chunk, ' '), Equal(chunk, '\t')));
+        if (others != 0)
+            return i + LowestBit(others) / BitsPerChar;
+    }
+#endif
+    while (i < length && IsSpace(text[i]))
+        ++i;
+
+    return i;
+}
+
+// Return the length of the run of the text of a // comment, up to a newline,
+// or a backslash, which could start a line continuation.
+size_t FindLineCommentEnd(const unsigned char* text, size_t length)
+{
+    size_t i = 0;
+#if defined(GLSLANG_SCAN_SSE2) || defined(GLSLANG_SCAN_NEON)
+    for (; i + ChunkSize <= length; i += ChunkSize) {
+        TChunk chunk = Load(text + i);
+        TChunkMask stops = Found(Or(Or(Equal(chunk, '\n'), Equal(chunk, '\r')), Equal(chunk, '\\')));
+        if (stops != 0)
+            return i + LowestBit(stops) / BitsPerChar;
+    }
+#endif
+    while (i < length && ! IsLineCommentStop(text[i]))
+        ++i;
+
+    return i;
+}
+
+// Return the length of the run of the text of a /* comment, up to a '*' or a
+// backslash, also counting the newlines in the run and finding the last one.
+size_t FindBlockCommentEnd(const unsigned char* text, size_t length, int& newlines, size_t& lastNewline)
+{
+    size_t i = 0;
+#if defined(GLSLANG_SCAN_SSE2) || defined(GLSLANG_SCAN_NEON)
+    for (; i + ChunkSize <= length; i += ChunkSize) {
+        TChunk chunk = Load(text + i);
+        TChunkMask stops = Found(Or(Equal(chunk, '*'), Equal(chunk, '\\')));
+        TChunkMask lines = Found(Equal(chunk, '\n'));
+        if (stops != 0)
+            lines &= (stops & (~stops + 1)) - 1;    // just the newlines before the first stop
+        for (; lines != 0; lines &= lines - 1) {
+            ++newlines;
+            lastNewline = i + LowestBit(lines) / BitsPerChar;
+        }
+        if (stops != 0)
+            return i + LowestBit(stops) / BitsPerChar;
+    }
+#endif
+    for (; i < length && ! IsBlockCommentStop(text[i]); ++i) {
+        if (text[i] == '\n') {
+            ++newlines;
+            lastNewline = i;
+        }
+    }
+
+    return i;
+}
+
+// Return the length of the run of identifier characters starting 'text'.
+size_t FindIdentifierEnd(const unsigned char* text, size_t length)
+{
+    size_t i = 0;
+#if defined(GLSLANG_SCAN_SSE2) || defined(GLSLANG_SCAN_NEON)
+    for (; i + ChunkSize <= length; i += ChunkSize) {
+        TChunk chunk = Load(text + i);
+        TChunk letters = Or(InRange(chunk, 'a', 'z'), InRange(chunk, 'A', 'Z'));
+        TChunkMask others = NotFound(Or(Or(letters, InRange(chunk, '0', '9')), Equal(chunk, '_')));
+        if (others != 0)
+            return i + LowestBit(others) / BitsPerChar;
+    }
+#endif
+    while (i < length && IsIdentifierChar(text[i]))
+        ++i;
+
+    return i;
+}
+
+} // end anonymous namespace
+
+// Consume 'count' characters of the current string, 'newlines' of them newlines,
+// the last of those at 'lastNewline', keeping locations as get() would.
+void TInputScanner::advanceInString(size_t count, int newlines, size_t lastNewline)
+{
+    if (count == 0)
+        return;
+
+    if (newlines == 0) {
+        loc[currentSource].column += (int)count;
+        logicalSourceLoc.column += (int)count;
+    } else {
+        loc[currentSource].line += newlines;
+        logicalSourceLoc.line += newlines;
+        loc[currentSource].column = (int)(count - lastNewline - 1);
+        logicalSourceLoc.column = (int)(count - lastNewline - 1);
+    }
+
+    currentChar += count - 1;
+    advance();
+}
+
+// The unread part of the current string, which is empty at the end of a string.
+const unsigned char* TInputScanner::unreadInString(size_t& length) const
+{
+    if (currentSource >= numSources || currentChar >= lengths[currentSource]) {
+        length = 0;
+        return nullptr;
+    }
+
+    length = lengths[currentSource] - currentChar;
+    return sources[currentSource] + currentChar;
+}
+
+size_t TInputScanner::getSpaces()
+{
+    size_t length;
+    const unsigned char* text = unreadInString(length);
+    size_t count = FindSpacesEnd(text, length);
+    advanceInString(count, 0, 0);
+
+    return count;
+}
+
+size_t TInputScanner::getLineCommentText()
+{
+    size_t length;
+    const unsigned char* text = unreadInString(length);
+    size_t count = FindLineCommentEnd(text, length);
+    advanceInString(count, 0, 0);
+
+    return count;
+}
+
+size_t TInputScanner::getBlockCommentText()
+{
+    size_t length;
+    const unsigned char* text = unreadInString(length);
+    int newlines = 0;
+    size_t lastNewline = 0;
+    size_t count = FindBlockCommentEnd(text, length, newlines, lastNewline);
+    advanceInString(count, newlines, lastNewline);
+
+    return count;
+}
+
+const char* TInputScanner::getIdentifierText(size_t& count)
+{
+    size_t length;
+    const unsigned char* text = unreadInString(length);
+    count = FindIdentifierEnd(text, length);
+    advanceInString(count, 0, 0);
+
+    return reinterpret_cast<const char*>(text);
+}
+
 // read past any white space
 void TInputScanner::consumeWhiteSpace(bool& foundNonSpaceTab)
 {
@@ -298,484 +557,468 @@ int yylex(YYSTYPE* glslangTokenDesc, glslang::TParseContext& parseContext)
 
 namespace {
 
-struct str_eq
+// Hash of an identifier, usable in case labels, so that keywords are recognized
+// through a switch laid out by the compiler instead of a table built at run time.
+// Two keywords hashing the same would be duplicate case labels, so any collision
+// is caught when compiling.
+constexpr unsigned int KeywordHash(const char* str, unsigned int hash = 5381)
 {
-    bool operator()(const char* lhs, const char* rhs) const
-    {
-        return strcmp(lhs, rhs) == 0;
-    }
-};
-
-struct str_hash
-{
-    size_t operator()(const char* str) const
-    {
-        // djb2
-        unsigned long hash = 5381;
-        int c;
-
-        while ((c = *str++) != 0)
-            hash = ((hash << 5) + hash) + c;
-
-        return hash;
-    }
-};
-
-// A single global usable by all threads, by all versions, by all languages.
-// After a single process-level initialization, this is read only and thread safe
-std::unordered_map<const char*, int, str_hash, str_eq>* KeywordMap = nullptr;
-#ifndef GLSLANG_WEB
-std::unordered_set<const char*, str_hash, str_eq>* ReservedSet = nullptr;
-#endif
-
-};
+    // djb2
+    return *str == 0 ? hash : KeywordHash(str + 1, hash * 33 + (unsigned char)*str);
+}
 
-namespace glslang {
+#define KEYWORD(name, token) case KeywordHash(name): return strcmp(text, name) == 0 ? (token) : 0
+#define RESERVED(name) case KeywordHash(name): return strcmp(text, name) == 0
 
-void TScanContext::fillInKeywordMap()
+// Returns the token for the keyword 'text' is, or 0 if it is not a keyword.
+int KeywordToken(const char* text)
 {
-    if (KeywordMap != nullptr) {
-        // this is really an error, as this should called only once per process
-        // but, the only risk is if two threads called simultaneously
-        return;
-    }
-    KeywordMap = new std::unordered_map<const char*, int, str_hash, str_eq>;
-
-    (*KeywordMap)["const"] =                   CONST;
-    (*KeywordMap)["uniform"] =                 UNIFORM;
-    (*KeywordMap)["buffer"] =                  BUFFER;
-    (*KeywordMap)["in"] =                      IN;
-    (*KeywordMap)["out"] =                     OUT;
-    (*KeywordMap)["smooth"] =                  SMOOTH;
-    (*KeywordMap)["flat"] =                    FLAT;
-    (*KeywordMap)["centroid"] =                CENTROID;
-    (*KeywordMap)["invariant"] =               INVARIANT;
-    (*KeywordMap)["packed"] =                  PACKED;
-    (*KeywordMap)["resource"] =                RESOURCE;
-    (*KeywordMap)["inout"] =                   INOUT;
-    (*KeywordMap)["struct"] =                  STRUCT;
-    (*KeywordMap)["break"] =                   BREAK;
-    (*KeywordMap)["continue"] =                CONTINUE;
-    (*KeywordMap)["do"] =                      DO;
-    (*KeywordMap)["for"] =                     FOR;
-    (*KeywordMap)["while"] =                   WHILE;
-    (*KeywordMap)["switch"] =                  SWITCH;
-    (*KeywordMap)["case"] =                    CASE;
-    (*KeywordMap)["default"] =                 DEFAULT;
-    (*KeywordMap)["if"] =                      IF;
-    (*KeywordMap)["else"] =                    ELSE;
-    (*KeywordMap)["discard"] =                 DISCARD;
-    (*KeywordMap)["return"] =                  RETURN;
-    (*KeywordMap)["void"] =                    VOID;
-    (*KeywordMap)["bool"] =                    BOOL;
-    (*KeywordMap)["float"] =                   FLOAT;
-    (*KeywordMap)["int"] =                     INT;
-    (*KeywordMap)["bvec2"] =                   BVEC2;
-    (*KeywordMap)["bvec3"] =                   BVEC3;
-    (*KeywordMap)["bvec4"] =                   BVEC4;
-    (*KeywordMap)["vec2"] =                    VEC2;
-    (*KeywordMap)["vec3"] =                    VEC3;
-    (*KeywordMap)["vec4"] =                    VEC4;
-    (*KeywordMap)["ivec2"] =                   IVEC2;
-    (*KeywordMap)["ivec3"] =                   IVEC3;
-    (*KeywordMap)["ivec4"] =                   IVEC4;
-    (*KeywordMap)["mat2"] =                    MAT2;
-    (*KeywordMap)["mat3"] =                    MAT3;
-    (*KeywordMap)["mat4"] =                    MAT4;
-    (*KeywordMap)["true"] =                    BOOLCONSTANT;
-    (*KeywordMap)["false"] =                   BOOLCONSTANT;
-    (*KeywordMap)["layout"] =                  LAYOUT;
-    (*KeywordMap)["shared"] =                  SHARED;
-    (*KeywordMap)["highp"] =                   HIGH_PRECISION;
-    (*KeywordMap)["mediump"] =                 MEDIUM_PRECISION;
-    (*KeywordMap)["lowp"] =                    LOW_PRECISION;
-    (*KeywordMap)["superp"] =                  SUPERP;
-    (*KeywordMap)["precision"] =               PRECISION;
-    (*KeywordMap)["mat2x2"] =                  MAT2X2;
-    (*KeywordMap)["mat2x3"] =                  MAT2X3;
-    (*KeywordMap)["mat2x4"] =                  MAT2X4;
-    (*KeywordMap)["mat3x2"] =                  MAT3X2;
-    (*KeywordMap)["mat3x3"] =                  MAT3X3;
-    (*KeywordMap)["mat3x4"] =                  MAT3X4;
-    (*KeywordMap)["mat4x2"] =                  MAT4X2;
-    (*KeywordMap)["mat4x3"] =                  MAT4X3;
-    (*KeywordMap)["mat4x4"] =                  MAT4X4;
-    (*KeywordMap)["uint"] =                    UINT;
-    (*KeywordMap)["uvec2"] =                   UVEC2;
-    (*KeywordMap)["uvec3"] =                   UVEC3;
-    (*KeywordMap)["uvec4"] =                   UVEC4;
+    switch (KeywordHash(text)) {
+    KEYWORD("const",                   CONST);
+    KEYWORD("uniform",                 UNIFORM);
+    KEYWORD("buffer",                  BUFFER);
+    KEYWORD("in",                      IN);
+    KEYWORD("out",                     OUT);
+    KEYWORD("smooth",                  SMOOTH);
+    KEYWORD("flat",                    FLAT);
+    KEYWORD("centroid",                CENTROID);
+    KEYWORD("invariant",               INVARIANT);
+    KEYWORD("packed",                  PACKED);
+    KEYWORD("resource",                RESOURCE);
+    KEYWORD("inout",                   INOUT);
+    KEYWORD("struct",                  STRUCT);
+    KEYWORD("break",                   BREAK);
+    KEYWORD("continue",                CONTINUE);
+    KEYWORD("do",                      DO);
+    KEYWORD("for",                     FOR);
+    KEYWORD("while",                   WHILE);
+    KEYWORD("switch",                  SWITCH);
+    KEYWORD("case",                    CASE);
+    KEYWORD("default",                 DEFAULT);
+    KEYWORD("if",                      IF);
+    KEYWORD("else",                    ELSE);
+    KEYWORD("discard",                 DISCARD);
+    KEYWORD("return",                  RETURN);
+    KEYWORD("void",                    VOID);
+    KEYWORD("bool",                    BOOL);
+    KEYWORD("float",                   FLOAT);
+    KEYWORD("int",                     INT);
+    KEYWORD("bvec2",                   BVEC2);
+    KEYWORD("bvec3",                   BVEC3);
+    KEYWORD("bvec4",                   BVEC4);
+    KEYWORD("vec2",                    VEC2);
+    KEYWORD("vec3",                    VEC3);
+    KEYWORD("vec4",                    VEC4);
+    KEYWORD("ivec2",                   IVEC2);
+    KEYWORD("ivec3",                   IVEC3);
+    KEYWORD("ivec4",                   IVEC4);
+    KEYWORD("mat2",                    MAT2);
+    KEYWORD("mat3",                    MAT3);
+    KEYWORD("mat4",                    MAT4);
+    KEYWORD("true",                    BOOLCONSTANT);
+    KEYWORD("false",                   BOOLCONSTANT);
+    KEYWORD("layout",                  LAYOUT);
+    KEYWORD("shared",                  SHARED);
+    KEYWORD("highp",                   HIGH_PRECISION);
+    KEYWORD("mediump",                 MEDIUM_PRECISION);
+    KEYWORD("lowp",                    LOW_PRECISION);
+    KEYWORD("superp",                  SUPERP);
+    KEYWORD("precision",               PRECISION);
+    KEYWORD("mat2x2",                  MAT2X2);
+    KEYWORD("mat2x3",                  MAT2X3);
+    KEYWORD("mat2x4",                  MAT2X4);
+    KEYWORD("mat3x2",                  MAT3X2);
+    KEYWORD("mat3x3",                  MAT3X3);
+    KEYWORD("mat3x4",                  MAT3X4);
+    KEYWORD("mat4x2",                  MAT4X2);
+    KEYWORD("mat4x3",                  MAT4X3);
+    KEYWORD("mat4x4",                  MAT4X4);
+    KEYWORD("uint",                    UINT);
+    KEYWORD("uvec2",                   UVEC2);
+    KEYWORD("uvec3",                   UVEC3);
+    KEYWORD("uvec4",                   UVEC4);
 
 #ifndef GLSLANG_WEB
-    (*KeywordMap)["nonuniformEXT"] =           NONUNIFORM;
-    (*KeywordMap)["demote"] =                  DEMOTE;
-    (*KeywordMap)["attribute"] =               ATTRIBUTE;
-    (*KeywordMap)["varying"] =                 VARYING;
-    (*KeywordMap)["noperspective"] =           NOPERSPECTIVE;
-    (*KeywordMap)["coherent"] =                COHERENT;
-    (*KeywordMap)["devicecoherent"] =          DEVICECOHERENT;
-    (*KeywordMap)["queuefamilycoherent"] =     QUEUEFAMILYCOHERENT;
-    (*KeywordMap)["workgroupcoherent"] =       WORKGROUPCOHERENT;
-    (*KeywordMap)["subgroupcoherent"] =        SUBGROUPCOHERENT;
-    (*KeywordMap)["shadercallcoherent"] =      SHADERCALLCOHERENT;
-    (*KeywordMap)["nonprivate"] =              NONPRIVATE;
-    (*KeywordMap)["restrict"] =                RESTRICT;
-    (*KeywordMap)["readonly"] =                READONLY;
-    (*KeywordMap)["writeonly"] =               WRITEONLY;
-    (*KeywordMap)["atomic_uint"] =             ATOMIC_UINT;
-    (*KeywordMap)["volatile"] =                VOLATILE;
-    (*KeywordMap)["patch"] =                   PATCH;
-    (*KeywordMap)["sample"] =                  SAMPLE;
-    (*KeywordMap)["subroutine"] =              SUBROUTINE;
-    (*KeywordMap)["dmat2"] =                   DMAT2;
-    (*KeywordMap)["dmat3"] =                   DMAT3;
-    (*KeywordMap)["dmat4"] =                   DMAT4;
-    (*KeywordMap)["dmat2x2"] =                 DMAT2X2;
-    (*KeywordMap)["dmat2x3"] =                 DMAT2X3;
-    (*KeywordMap)["dmat2x4"] =                 DMAT2X4;
-    (*KeywordMap)["dmat3x2"] =                 DMAT3X2;
-    (*KeywordMap)["dmat3x3"] =                 DMAT3X3;
-    (*KeywordMap)["dmat3x4"] =                 DMAT3X4;
-    (*KeywordMap)["dmat4x2"] =                 DMAT4X2;
-    (*KeywordMap)["dmat4x3"] =                 DMAT4X3;
-    (*KeywordMap)["dmat4x4"] =                 DMAT4X4;
-    (*KeywordMap)["image1D"] =                 IMAGE1D;
-    (*KeywordMap)["iimage1D"] =                IIMAGE1D;
-    (*KeywordMap)["uimage1D"] =                UIMAGE1D;
-    (*KeywordMap)["image2D"] =                 IMAGE2D;
-    (*KeywordMap)["iimage2D"] =                IIMAGE2D;
-    (*KeywordMap)["uimage2D"] =                UIMAGE2D;
-    (*KeywordMap)["image3D"] =                 IMAGE3D;
-    (*KeywordMap)["iimage3D"] =                IIMAGE3D;
-    (*KeywordMap)["uimage3D"] =                UIMAGE3D;
-    (*KeywordMap)["image2DRect"] =             IMAGE2DRECT;
-    (*KeywordMap)["iimage2DRect"] =            IIMAGE2DRECT;
-    (*KeywordMap)["uimage2DRect"] =            UIMAGE2DRECT;
-    (*KeywordMap)["imageCube"] =               IMAGECUBE;
-    (*KeywordMap)["iimageCube"] =              IIMAGECUBE;
-    (*KeywordMap)["uimageCube"] =              UIMAGECUBE;
-    (*KeywordMap)["imageBuffer"] =             IMAGEBUFFER;
-    (*KeywordMap)["iimageBuffer"] =            IIMAGEBUFFER;
-    (*KeywordMap)["uimageBuffer"] =            UIMAGEBUFFER;
-    (*KeywordMap)["image1DArray"] =            IMAGE1DARRAY;
-    (*KeywordMap)["iimage1DArray"] =           IIMAGE1DARRAY;
-    (*KeywordMap)["uimage1DArray"] =           UIMAGE1DARRAY;
-    (*KeywordMap)["image2DArray"] =            IMAGE2DARRAY;
-    (*KeywordMap)["iimage2DArray"] =           IIMAGE2DARRAY;
-    (*KeywordMap)["uimage2DArray"] =           UIMAGE2DARRAY;
-    (*KeywordMap)["imageCubeArray"] =          IMAGECUBEARRAY;
-    (*KeywordMap)["iimageCubeArray"] =         IIMAGECUBEARRAY;
-    (*KeywordMap)["uimageCubeArray"] =         UIMAGECUBEARRAY;
-    (*KeywordMap)["image2DMS"] =               IMAGE2DMS;
-    (*KeywordMap)["iimage2DMS"] =              IIMAGE2DMS;
-    (*KeywordMap)["uimage2DMS"] =              UIMAGE2DMS;
-    (*KeywordMap)["image2DMSArray"] =          IMAGE2DMSARRAY;
-    (*KeywordMap)["iimage2DMSArray"] =         IIMAGE2DMSARRAY;
-    (*KeywordMap)["uimage2DMSArray"] =         UIMAGE2DMSARRAY;
-    (*KeywordMap)["double"] =                  DOUBLE;
-    (*KeywordMap)["dvec2"] =                   DVEC2;
-    (*KeywordMap)["dvec3"] =                   DVEC3;
-    (*KeywordMap)["dvec4"] =                   DVEC4;
-    (*KeywordMap)["int64_t"] =                 INT64_T;
-    (*KeywordMap)["uint64_t"] =                UINT64_T;
-    (*KeywordMap)["i64vec2"] =                 I64VEC2;
-    (*KeywordMap)["i64vec3"] =                 I64VEC3;
-    (*KeywordMap)["i64vec4"] =                 I64VEC4;
-    (*KeywordMap)["u64vec2"] =                 U64VEC2;
-    (*KeywordMap)["u64vec3"] =                 U64VEC3;
-    (*KeywordMap)["u64vec4"] =                 U64VEC4;
+    KEYWORD("nonuniformEXT",           NONUNIFORM);
+    KEYWORD("demote",                  DEMOTE);
+    KEYWORD("attribute",               ATTRIBUTE);
+    KEYWORD("varying",                 VARYING);
+    KEYWORD("noperspective",           NOPERSPECTIVE);
+    KEYWORD("coherent",                COHERENT);
+    KEYWORD("devicecoherent",          DEVICECOHERENT);
+    KEYWORD("queuefamilycoherent",     QUEUEFAMILYCOHERENT);
+    KEYWORD("workgroupcoherent",       WORKGROUPCOHERENT);
+    KEYWORD("subgroupcoherent",        SUBGROUPCOHERENT);
+    KEYWORD("shadercallcoherent",      SHADERCALLCOHERENT);
+    KEYWORD("nonprivate",              NONPRIVATE);
+    KEYWORD("restrict",                RESTRICT);
+    KEYWORD("readonly",                READONLY);
+    KEYWORD("writeonly",               WRITEONLY);
+    KEYWORD("atomic_uint",             ATOMIC_UINT);
+    KEYWORD("volatile",                VOLATILE);
+    KEYWORD("patch",                   PATCH);
+    KEYWORD("sample",                  SAMPLE);
+    KEYWORD("subroutine",              SUBROUTINE);
+    KEYWORD("dmat2",                   DMAT2);
+    KEYWORD("dmat3",                   DMAT3);
+    KEYWORD("dmat4",                   DMAT4);
+    KEYWORD("dmat2x2",                 DMAT2X2);
+    KEYWORD("dmat2x3",                 DMAT2X3);
+    KEYWORD("dmat2x4",                 DMAT2X4);
+    KEYWORD("dmat3x2",                 DMAT3X2);
+    KEYWORD("dmat3x3",                 DMAT3X3);
+    KEYWORD("dmat3x4",                 DMAT3X4);
+    KEYWORD("dmat4x2",                 DMAT4X2);
+    KEYWORD("dmat4x3",                 DMAT4X3);
+    KEYWORD("dmat4x4",                 DMAT4X4);
+    KEYWORD("image1D",                 IMAGE1D);
+    KEYWORD("iimage1D",                IIMAGE1D);
+    KEYWORD("uimage1D",                UIMAGE1D);
+    KEYWORD("image2D",                 IMAGE2D);
+    KEYWORD("iimage2D",                IIMAGE2D);
+    KEYWORD("uimage2D",                UIMAGE2D);
+    KEYWORD("image3D",                 IMAGE3D);
+    KEYWORD("iimage3D",                IIMAGE3D);
+    KEYWORD("uimage3D",                UIMAGE3D);
+    KEYWORD("image2DRect",             IMAGE2DRECT);
+    KEYWORD("iimage2DRect",            IIMAGE2DRECT);
+    KEYWORD("uimage2DRect",            UIMAGE2DRECT);
+    KEYWORD("imageCube",               IMAGECUBE);
+    KEYWORD("iimageCube",              IIMAGECUBE);
+    KEYWORD("uimageCube",              UIMAGECUBE);
+    KEYWORD("imageBuffer",             IMAGEBUFFER);
+    KEYWORD("iimageBuffer",            IIMAGEBUFFER);
+    KEYWORD("uimageBuffer",            UIMAGEBUFFER);
+    KEYWORD("image1DArray",            IMAGE1DARRAY);
+    KEYWORD("iimage1DArray",           IIMAGE1DARRAY);
+    KEYWORD("uimage1DArray",           UIMAGE1DARRAY);
+    KEYWORD("image2DArray",            IMAGE2DARRAY);
+    KEYWORD("iimage2DArray",           IIMAGE2DARRAY);
+    KEYWORD("uimage2DArray",           UIMAGE2DARRAY);
+    KEYWORD("imageCubeArray",          IMAGECUBEARRAY);
+    KEYWORD("iimageCubeArray",         IIMAGECUBEARRAY);
+    KEYWORD("uimageCubeArray",         UIMAGECUBEARRAY);
+    KEYWORD("image2DMS",               IMAGE2DMS);
+    KEYWORD("iimage2DMS",              IIMAGE2DMS);
+    KEYWORD("uimage2DMS",              UIMAGE2DMS);
+    KEYWORD("image2DMSArray",          IMAGE2DMSARRAY);
+    KEYWORD("iimage2DMSArray",         IIMAGE2DMSARRAY);
+    KEYWORD("uimage2DMSArray",         UIMAGE2DMSARRAY);
+    KEYWORD("double",                  DOUBLE);
+    KEYWORD("dvec2",                   DVEC2);
+    KEYWORD("dvec3",                   DVEC3);
+    KEYWORD("dvec4",                   DVEC4);
+    KEYWORD("int64_t",                 INT64_T);
+    KEYWORD("uint64_t",                UINT64_T);
+    KEYWORD("i64vec2",                 I64VEC2);
+    KEYWORD("i64vec3",                 I64VEC3);
+    KEYWORD("i64vec4",                 I64VEC4);
+    KEYWORD("u64vec2",                 U64VEC2);
+    KEYWORD("u64vec3",                 U64VEC3);
+    KEYWORD("u64vec4",                 U64VEC4);
 
     // GL_EXT_shader_explicit_arithmetic_types
-    (*KeywordMap)["int8_t"] =                  INT8_T;
-    (*KeywordMap)["i8vec2"] =                  I8VEC2;
-    (*KeywordMap)["i8vec3"] =                  I8VEC3;
-    (*KeywordMap)["i8vec4"] =                  I8VEC4;
-    (*KeywordMap)["uint8_t"] =                 UINT8_T;
-    (*KeywordMap)["u8vec2"] =                  U8VEC2;
-    (*KeywordMap)["u8vec3"] =                  U8VEC3;
-    (*KeywordMap)["u8vec4"] =                  U8VEC4;
-
-    (*KeywordMap)["int16_t"] =                 INT16_T;
-    (*KeywordMap)["i16vec2"] =                 I16VEC2;
-    (*KeywordMap)["i16vec3"] =                 I16VEC3;
-    (*KeywordMap)["i16vec4"] =                 I16VEC4;
-    (*KeywordMap)["uint16_t"] =                UINT16_T;
-    (*KeywordMap)["u16vec2"] =                 U16VEC2;
-    (*KeywordMap)["u16vec3"] =                 U16VEC3;
-    (*KeywordMap)["u16vec4"] =                 U16VEC4;
-
-    (*KeywordMap)["int32_t"] =                 INT32_T;
-    (*KeywordMap)["i32vec2"] =                 I32VEC2;
-    (*KeywordMap)["i32vec3"] =                 I32VEC3;
-    (*KeywordMap)["i32vec4"] =                 I32VEC4;
-    (*KeywordMap)["uint32_t"] =                UINT32_T;
-    (*KeywordMap)["u32vec2"] =                 U32VEC2;
-    (*KeywordMap)["u32vec3"] =                 U32VEC3;
-    (*KeywordMap)["u32vec4"] =                 U32VEC4;
-
-    (*KeywordMap)["float16_t"] =               FLOAT16_T;
-    (*KeywordMap)["f16vec2"] =                 F16VEC2;
-    (*KeywordMap)["f16vec3"] =                 F16VEC3;
-    (*KeywordMap)["f16vec4"] =                 F16VEC4;
-    (*KeywordMap)["f16mat2"] =                 F16MAT2;
-    (*KeywordMap)["f16mat3"] =                 F16MAT3;
-    (*KeywordMap)["f16mat4"] =                 F16MAT4;
-    (*KeywordMap)["f16mat2x2"] =               F16MAT2X2;
-    (*KeywordMap)["f16mat2x3"] =               F16MAT2X3;
-    (*KeywordMap)["f16mat2x4"] =               F16MAT2X4;
-    (*KeywordMap)["f16mat3x2"] =               F16MAT3X2;
-    (*KeywordMap)["f16mat3x3"] =               F16MAT3X3;
-    (*KeywordMap)["f16mat3x4"] =               F16MAT3X4;
-    (*KeywordMap)["f16mat4x2"] =               F16MAT4X2;
-    (*KeywordMap)["f16mat4x3"] =               F16MAT4X3;
-    (*KeywordMap)["f16mat4x4"] =               F16MAT4X4;
-
-    (*KeywordMap)["float32_t"] =               FLOAT32_T;
-    (*KeywordMap)["f32vec2"] =                 F32VEC2;
-    (*KeywordMap)["f32vec3"] =                 F32VEC3;
-    (*KeywordMap)["f32vec4"] =                 F32VEC4;
-    (*KeywordMap)["f32mat2"] =                 F32MAT2;
-    (*KeywordMap)["f32mat3"] =                 F32MAT3;
-    (*KeywordMap)["f32mat4"] =                 F32MAT4;
-    (*KeywordMap)["f32mat2x2"] =               F32MAT2X2;
-    (*KeywordMap)["f32mat2x3"] =               F32MAT2X3;
-    (*KeywordMap)["f32mat2x4"] =               F32MAT2X4;
-    (*KeywordMap)["f32mat3x2"] =               F32MAT3X2;
-    (*KeywordMap)["f32mat3x3"] =               F32MAT3X3;
-    (*KeywordMap)["f32mat3x4"] =               F32MAT3X4;
-    (*KeywordMap)["f32mat4x2"] =               F32MAT4X2;
-    (*KeywordMap)["f32mat4x3"] =               F32MAT4X3;
-    (*KeywordMap)["f32mat4x4"] =               F32MAT4X4;
-    (*KeywordMap)["float64_t"] =               FLOAT64_T;
-    (*KeywordMap)["f64vec2"] =                 F64VEC2;
-    (*KeywordMap)["f64vec3"] =                 F64VEC3;
-    (*KeywordMap)["f64vec4"] =                 F64VEC4;
-    (*KeywordMap)["f64mat2"] =                 F64MAT2;
-    (*KeywordMap)["f64mat3"] =                 F64MAT3;
-    (*KeywordMap)["f64mat4"] =                 F64MAT4;
-    (*KeywordMap)["f64mat2x2"] =               F64MAT2X2;
-    (*KeywordMap)["f64mat2x3"] =               F64MAT2X3;
-    (*KeywordMap)["f64mat2x4"] =               F64MAT2X4;
-    (*KeywordMap)["f64mat3x2"] =               F64MAT3X2;
-    (*KeywordMap)["f64mat3x3"] =               F64MAT3X3;
-    (*KeywordMap)["f64mat3x4"] =               F64MAT3X4;
-    (*KeywordMap)["f64mat4x2"] =               F64MAT4X2;
-    (*KeywordMap)["f64mat4x3"] =               F64MAT4X3;
-    (*KeywordMap)["f64mat4x4"] =               F64MAT4X4;
+    KEYWORD("int8_t",                  INT8_T);
+    KEYWORD("i8vec2",                  I8VEC2);
+    KEYWORD("i8vec3",                  I8VEC3);
+    KEYWORD("i8vec4",                  I8VEC4);
+    KEYWORD("uint8_t",                 UINT8_T);
+    KEYWORD("u8vec2",                  U8VEC2);
+    KEYWORD("u8vec3",                  U8VEC3);
+    KEYWORD("u8vec4",                  U8VEC4);
+
+    KEYWORD("int16_t",                 INT16_T);
+    KEYWORD("i16vec2",                 I16VEC2);
+    KEYWORD("i16vec3",                 I16VEC3);
+    KEYWORD("i16vec4",                 I16VEC4);
+    KEYWORD("uint16_t",                UINT16_T);
+    KEYWORD("u16vec2",                 U16VEC2);
+    KEYWORD("u16vec3",                 U16VEC3);
+    KEYWORD("u16vec4",                 U16VEC4);
+
+    KEYWORD("int32_t",                 INT32_T);
+    KEYWORD("i32vec2",                 I32VEC2);
+    KEYWORD("i32vec3",                 I32VEC3);
+    KEYWORD("i32vec4",                 I32VEC4);
+    KEYWORD("uint32_t",                UINT32_T);
+    KEYWORD("u32vec2",                 U32VEC2);
+    KEYWORD("u32vec3",                 U32VEC3);
+    KEYWORD("u32vec4",                 U32VEC4);
+
+    KEYWORD("float16_t",               FLOAT16_T);
+    KEYWORD("f16vec2",                 F16VEC2);
+    KEYWORD("f16vec3",                 F16VEC3);
+    KEYWORD("f16vec4",                 F16VEC4);
+    KEYWORD("f16mat2",                 F16MAT2);
+    KEYWORD("f16mat3",                 F16MAT3);
+    KEYWORD("f16mat4",                 F16MAT4);
+    KEYWORD("f16mat2x2",               F16MAT2X2);
+    KEYWORD("f16mat2x3",               F16MAT2X3);
+    KEYWORD("f16mat2x4",               F16MAT2X4);
+    KEYWORD("f16mat3x2",               F16MAT3X2);
+    KEYWORD("f16mat3x3",               F16MAT3X3);
+    KEYWORD("f16mat3x4",               F16MAT3X4);
+    KEYWORD("f16mat4x2",               F16MAT4X2);
+    KEYWORD("f16mat4x3",               F16MAT4X3);
+    KEYWORD("f16mat4x4",               F16MAT4X4);
+
+    KEYWORD("float32_t",               FLOAT32_T);
+    KEYWORD("f32vec2",                 F32VEC2);
+    KEYWORD("f32vec3",                 F32VEC3);
+    KEYWORD("f32vec4",                 F32VEC4);
+    KEYWORD("f32mat2",                 F32MAT2);
+    KEYWORD("f32mat3",                 F32MAT3);
+    KEYWORD("f32mat4",                 F32MAT4);
+    KEYWORD("f32mat2x2",               F32MAT2X2);
+    KEYWORD("f32mat2x3",               F32MAT2X3);
+    KEYWORD("f32mat2x4",               F32MAT2X4);
+    KEYWORD("f32mat3x2",               F32MAT3X2);
+    KEYWORD("f32mat3x3",               F32MAT3X3);
+    KEYWORD("f32mat3x4",               F32MAT3X4);
+    KEYWORD("f32mat4x2",               F32MAT4X2);
+    KEYWORD("f32mat4x3",               F32MAT4X3);
+    KEYWORD("f32mat4x4",               F32MAT4X4);
+    KEYWORD("float64_t",               FLOAT64_T);
+    KEYWORD("f64vec2",                 F64VEC2);
+    KEYWORD("f64vec3",                 F64VEC3);
+    KEYWORD("f64vec4",                 F64VEC4);
+    KEYWORD("f64mat2",                 F64MAT2);
+    KEYWORD("f64mat3",                 F64MAT3);
+    KEYWORD("f64mat4",                 F64MAT4);
+    KEYWORD("f64mat2x2",               F64MAT2X2);
+    KEYWORD("f64mat2x3",               F64MAT2X3);
+    KEYWORD("f64mat2x4",               F64MAT2X4);
+    KEYWORD("f64mat3x2",               F64MAT3X2);
+    KEYWORD("f64mat3x3",               F64MAT3X3);
+    KEYWORD("f64mat3x4",               F64MAT3X4);
+    KEYWORD("f64mat4x2",               F64MAT4X2);
+    KEYWORD("f64mat4x3",               F64MAT4X3);
+    KEYWORD("f64mat4x4",               F64MAT4X4);
 #endif
 
-    (*KeywordMap)["sampler2D"] =               SAMPLER2D;
-    (*KeywordMap)["samplerCube"] =             SAMPLERCUBE;
-    (*KeywordMap)["samplerCubeShadow"] =       SAMPLERCUBESHADOW;
-    (*KeywordMap)["sampler2DArray"] =          SAMPLER2DARRAY;
-    (*KeywordMap)["sampler2DArrayShadow"] =    SAMPLER2DARRAYSHADOW;
-    (*KeywordMap)["isampler2D"] =              ISAMPLER2D;
-    (*KeywordMap)["isampler3D"] =              ISAMPLER3D;
-    (*KeywordMap)["isamplerCube"] =            ISAMPLERCUBE;
-    (*KeywordMap)["isampler2DArray"] =         ISAMPLER2DARRAY;
-    (*KeywordMap)["usampler2D"] =              USAMPLER2D;
-    (*KeywordMap)["usampler3D"] =              USAMPLER3D;
-    (*KeywordMap)["usamplerCube"] =            USAMPLERCUBE;
-    (*KeywordMap)["usampler2DArray"] =         USAMPLER2DARRAY;
-    (*KeywordMap)["sampler3D"] =               SAMPLER3D;
-    (*KeywordMap)["sampler2DShadow"] =         SAMPLER2DSHADOW;
-
-    (*KeywordMap)["texture2D"] =               TEXTURE2D;
-    (*KeywordMap)["textureCube"] =             TEXTURECUBE;
-    (*KeywordMap)["texture2DArray"] =          TEXTURE2DARRAY;
-    (*KeywordMap)["itexture2D"] =              ITEXTURE2D;
-    (*KeywordMap)["itexture3D"] =              ITEXTURE3D;
-    (*KeywordMap)["itextureCube"] =            ITEXTURECUBE;
-    (*KeywordMap)["itexture2DArray"] =         ITEXTURE2DARRAY;
-    (*KeywordMap)["utexture2D"] =              UTEXTURE2D;
-    (*KeywordMap)["utexture3D"] =              UTEXTURE3D;
-    (*KeywordMap)["utextureCube"] =            UTEXTURECUBE;
-    (*KeywordMap)["utexture2DArray"] =         UTEXTURE2DARRAY;
-    (*KeywordMap)["texture3D"] =               TEXTURE3D;
-
-    (*KeywordMap)["sampler"] =                 SAMPLER;
-    (*KeywordMap)["samplerShadow"] =           SAMPLERSHADOW;
+    KEYWORD("sampler2D",               SAMPLER2D);
+    KEYWORD("samplerCube",             SAMPLERCUBE);
+    KEYWORD("samplerCubeShadow",       SAMPLERCUBESHADOW);
+    KEYWORD("sampler2DArray",          SAMPLER2DARRAY);
+    KEYWORD("sampler2DArrayShadow",    SAMPLER2DARRAYSHADOW);
+    KEYWORD("isampler2D",              ISAMPLER2D);
+    KEYWORD("isampler3D",              ISAMPLER3D);
+    KEYWORD("isamplerCube",            ISAMPLERCUBE);
+    KEYWORD("isampler2DArray",         ISAMPLER2DARRAY);
+    KEYWORD("usampler2D",              USAMPLER2D);
+    KEYWORD("usampler3D",              USAMPLER3D);
+    KEYWORD("usamplerCube",            USAMPLERCUBE);
+    KEYWORD("usampler2DArray",         USAMPLER2DARRAY);
+    KEYWORD("sampler3D",               SAMPLER3D);
+    KEYWORD("sampler2DShadow",         SAMPLER2DSHADOW);
+
+    KEYWORD("texture2D",               TEXTURE2D);
+    KEYWORD("textureCube",             TEXTURECUBE);
+    KEYWORD("texture2DArray",          TEXTURE2DARRAY);
+    KEYWORD("itexture2D",              ITEXTURE2D);
+    KEYWORD("itexture3D",              ITEXTURE3D);
+    KEYWORD("itextureCube",            ITEXTURECUBE);
+    KEYWORD("itexture2DArray",         ITEXTURE2DARRAY);
+    KEYWORD("utexture2D",              UTEXTURE2D);
+    KEYWORD("utexture3D",              UTEXTURE3D);
+    KEYWORD("utextureCube",            UTEXTURECUBE);
+    KEYWORD("utexture2DArray",         UTEXTURE2DARRAY);
+    KEYWORD("texture3D",               TEXTURE3D);
+
+    KEYWORD("sampler",                 SAMPLER);
+    KEYWORD("samplerShadow",           SAMPLERSHADOW);
 
 #ifndef GLSLANG_WEB
-    (*KeywordMap)["textureCubeArray"] =        TEXTURECUBEARRAY;
-    (*KeywordMap)["itextureCubeArray"] =       ITEXTURECUBEARRAY;
-    (*KeywordMap)["utextureCubeArray"] =       UTEXTURECUBEARRAY;
-    (*KeywordMap)["samplerCubeArray"] =        SAMPLERCUBEARRAY;
-    (*KeywordMap)["samplerCubeArrayShadow"] =  SAMPLERCUBEARRAYSHADOW;
-    (*KeywordMap)["isamplerCubeArray"] =       ISAMPLERCUBEARRAY;
-    (*KeywordMap)["usamplerCubeArray"] =       USAMPLERCUBEARRAY;
-    (*KeywordMap)["sampler1DArrayShadow"] =    SAMPLER1DARRAYSHADOW;
-    (*KeywordMap)["isampler1DArray"] =         ISAMPLER1DARRAY;
-    (*KeywordMap)["usampler1D"] =              USAMPLER1D;
-    (*KeywordMap)["isampler1D"] =              ISAMPLER1D;
-    (*KeywordMap)["usampler1DArray"] =         USAMPLER1DARRAY;
-    (*KeywordMap)["samplerBuffer"] =           SAMPLERBUFFER;
-    (*KeywordMap)["isampler2DRect"] =          ISAMPLER2DRECT;
-    (*KeywordMap)["usampler2DRect"] =          USAMPLER2DRECT;
-    (*KeywordMap)["isamplerBuffer"] =          ISAMPLERBUFFER;
-    (*KeywordMap)["usamplerBuffer"] =          USAMPLERBUFFER;
-    (*KeywordMap)["sampler2DMS"] =             SAMPLER2DMS;
-    (*KeywordMap)["isampler2DMS"] =            ISAMPLER2DMS;
-    (*KeywordMap)["usampler2DMS"] =            USAMPLER2DMS;
-    (*KeywordMap)["sampler2DMSArray"] =        SAMPLER2DMSARRAY;
-    (*KeywordMap)["isampler2DMSArray"] =       ISAMPLER2DMSARRAY;
-    (*KeywordMap)["usampler2DMSArray"] =       USAMPLER2DMSARRAY;
-    (*KeywordMap)["sampler1D"] =               SAMPLER1D;
-    (*KeywordMap)["sampler1DShadow"] =         SAMPLER1DSHADOW;
-    (*KeywordMap)["sampler2DRect"] =           SAMPLER2DRECT;
-    (*KeywordMap)["sampler2DRectShadow"] =     SAMPLER2DRECTSHADOW;
-    (*KeywordMap)["sampler1DArray"] =          SAMPLER1DARRAY;
-
-    (*KeywordMap)["samplerExternalOES"] =      SAMPLEREXTERNALOES; // GL_OES_EGL_image_external
-
-    (*KeywordMap)["__samplerExternal2DY2YEXT"] = SAMPLEREXTERNAL2DY2YEXT; // GL_EXT_YUV_target
-
-    (*KeywordMap)["itexture1DArray"] =         ITEXTURE1DARRAY;
-    (*KeywordMap)["utexture1D"] =              UTEXTURE1D;
-    (*KeywordMap)["itexture1D"] =              ITEXTURE1D;
-    (*KeywordMap)["utexture1DArray"] =         UTEXTURE1DARRAY;
-    (*KeywordMap)["textureBuffer"] =           TEXTUREBUFFER;
-    (*KeywordMap)["itexture2DRect"] =          ITEXTURE2DRECT;
-    (*KeywordMap)["utexture2DRect"] =          UTEXTURE2DRECT;
-    (*KeywordMap)["itextureBuffer"] =          ITEXTUREBUFFER;
-    (*KeywordMap)["utextureBuffer"] =          UTEXTUREBUFFER;
-    (*KeywordMap)["texture2DMS"] =             TEXTURE2DMS;
-    (*KeywordMap)["itexture2DMS"] =            ITEXTURE2DMS;
-    (*KeywordMap)["utexture2DMS"] =            UTEXTURE2DMS;
-    (*KeywordMap)["texture2DMSArray"] =        TEXTURE2DMSARRAY;
-    (*KeywordMap)["itexture2DMSArray"] =       ITEXTURE2DMSARRAY;
-    (*KeywordMap)["utexture2DMSArray"] =       UTEXTURE2DMSARRAY;
-    (*KeywordMap)["texture1D"] =               TEXTURE1D;
-    (*KeywordMap)["texture2DRect"] =           TEXTURE2DRECT;
-    (*KeywordMap)["texture1DArray"] =          TEXTURE1DARRAY;
-
-    (*KeywordMap)["subpassInput"] =            SUBPASSINPUT;
-    (*KeywordMap)["subpassInputMS"] =          SUBPASSINPUTMS;
-    (*KeywordMap)["isubpassInput"] =           ISUBPASSINPUT;
-    (*KeywordMap)["isubpassInputMS"] =         ISUBPASSINPUTMS;
-    (*KeywordMap)["usubpassInput"] =           USUBPASSINPUT;
-    (*KeywordMap)["usubpassInputMS"] =         USUBPASSINPUTMS;
-
-    (*KeywordMap)["f16sampler1D"] =                 F16SAMPLER1D;
-    (*KeywordMap)["f16sampler2D"] =                 F16SAMPLER2D;
-    (*KeywordMap)["f16sampler3D"] =                 F16SAMPLER3D;
-    (*KeywordMap)["f16sampler2DRect"] =             F16SAMPLER2DRECT;
-    (*KeywordMap)["f16samplerCube"] =               F16SAMPLERCUBE;
-    (*KeywordMap)["f16sampler1DArray"] =            F16SAMPLER1DARRAY;
-    (*KeywordMap)["f16sampler2DArray"] =            F16SAMPLER2DARRAY;
-    (*KeywordMap)["f16samplerCubeArray"] =          F16SAMPLERCUBEARRAY;
-    (*KeywordMap)["f16samplerBuffer"] =             F16SAMPLERBUFFER;
-    (*KeywordMap)["f16sampler2DMS"] =               F16SAMPLER2DMS;
-    (*KeywordMap)["f16sampler2DMSArray"] =          F16SAMPLER2DMSARRAY;
-    (*KeywordMap)["f16sampler1DShadow"] =           F16SAMPLER1DSHADOW;
-    (*KeywordMap)["f16sampler2DShadow"] =           F16SAMPLER2DSHADOW;
-    (*KeywordMap)["f16sampler2DRectShadow"] =       F16SAMPLER2DRECTSHADOW;
-    (*KeywordMap)["f16samplerCubeShadow"] =         F16SAMPLERCUBESHADOW;
-    (*KeywordMap)["f16sampler1DArrayShadow"] =      F16SAMPLER1DARRAYSHADOW;
-    (*KeywordMap)["f16sampler2DArrayShadow"] =      F16SAMPLER2DARRAYSHADOW;
-    (*KeywordMap)["f16samplerCubeArrayShadow"] =    F16SAMPLERCUBEARRAYSHADOW;
-
-    (*KeywordMap)["f16image1D"] =                   F16IMAGE1D;
-    (*KeywordMap)["f16image2D"] =                   F16IMAGE2D;
-    (*KeywordMap)["f16image3D"] =                   F16IMAGE3D;
-    (*KeywordMap)["f16image2DRect"] =               F16IMAGE2DRECT;
-    (*KeywordMap)["f16imageCube"] =                 F16IMAGECUBE;
-    (*KeywordMap)["f16image1DArray"] =              F16IMAGE1DARRAY;
-    (*KeywordMap)["f16image2DArray"] =              F16IMAGE2DARRAY;
-    (*KeywordMap)["f16imageCubeArray"] =            F16IMAGECUBEARRAY;
-    (*KeywordMap)["f16imageBuffer"] =               F16IMAGEBUFFER;
-    (*KeywordMap)["f16image2DMS"] =                 F16IMAGE2DMS;
-    (*KeywordMap)["f16image2DMSArray"] =            F16IMAGE2DMSARRAY;
-
-    (*KeywordMap)["f16texture1D"] =                 F16TEXTURE1D;
-    (*KeywordMap)["f16texture2D"] =                 F16TEXTURE2D;
-    (*KeywordMap)["f16texture3D"] =                 F16TEXTURE3D;
-    (*KeywordMap)["f16texture2DRect"] =             F16TEXTURE2DRECT;
-    (*KeywordMap)["f16textureCube"] =               F16TEXTURECUBE;
-    (*KeywordMap)["f16texture1DArray"] =            F16TEXTURE1DARRAY;
-    (*KeywordMap)["f16texture2DArray"] =            F16TEXTURE2DARRAY;
-    (*KeywordMap)["f16textureCubeArray"] =          F16TEXTURECUBEARRAY;
-    (*KeywordMap)["f16textureBuffer"] =             F16TEXTUREBUFFER;
-    (*KeywordMap)["f16texture2DMS"] =               F16TEXTURE2DMS;
-    (*KeywordMap)["f16texture2DMSArray"] =          F16TEXTURE2DMSARRAY;
-
-    (*KeywordMap)["f16subpassInput"] =              F16SUBPASSINPUT;
-    (*KeywordMap)["f16subpassInputMS"] =            F16SUBPASSINPUTMS;
-    (*KeywordMap)["__explicitInterpAMD"] =     EXPLICITINTERPAMD;
-    (*KeywordMap)["pervertexNV"] =             PERVERTEXNV;
-    (*KeywordMap)["precise"] =                 PRECISE;
-
-    (*KeywordMap)["rayPayloadNV"] =            PAYLOADNV;
-    (*KeywordMap)["rayPayloadEXT"] =           PAYLOADEXT;
-    (*KeywordMap)["rayPayloadInNV"] =          PAYLOADINNV;
-    (*KeywordMap)["rayPayloadInEXT"] =         PAYLOADINEXT;
-    (*KeywordMap)["hitAttributeNV"] =          HITATTRNV;
-    (*KeywordMap)["hitAttributeEXT"] =         HITATTREXT;
-    (*KeywordMap)["callableDataNV"] =          CALLDATANV;
-    (*KeywordMap)["callableDataEXT"] =         CALLDATAEXT;
-    (*KeywordMap)["callableDataInNV"] =        CALLDATAINNV;
-    (*KeywordMap)["callableDataInEXT"] =       CALLDATAINEXT;
-    (*KeywordMap)["accelerationStructureNV"] = ACCSTRUCTNV;
-    (*KeywordMap)["accelerationStructureEXT"]   = ACCSTRUCTEXT;
-    (*KeywordMap)["rayQueryEXT"] =              RAYQUERYEXT;
-    (*KeywordMap)["perprimitiveNV"] =          PERPRIMITIVENV;
-    (*KeywordMap)["perviewNV"] =               PERVIEWNV;
-    (*KeywordMap)["taskNV"] =                  PERTASKNV;
-
-    (*KeywordMap)["fcoopmatNV"] =              FCOOPMATNV;
-    (*KeywordMap)["icoopmatNV"] =              ICOOPMATNV;
-    (*KeywordMap)["ucoopmatNV"] =              UCOOPMATNV;
-
-    ReservedSet = new std::unordered_set<const char*, str_hash, str_eq>;
-
-    ReservedSet->insert("common");
-    ReservedSet->insert("partition");
-    ReservedSet->insert("active");
-    ReservedSet->insert("asm");
-    ReservedSet->insert("class");
-    ReservedSet->insert("union");
-    ReservedSet->insert("enum");
-    ReservedSet->insert("typedef");
-    ReservedSet->insert("template");
-    ReservedSet->insert("this");
-    ReservedSet->insert("goto");
-    ReservedSet->insert("inline");
-    ReservedSet->insert("noinline");
-    ReservedSet->insert("public");
-    ReservedSet->insert("static");
-    ReservedSet->insert("extern");
-    ReservedSet->insert("external");
-    ReservedSet->insert("interface");
-    ReservedSet->insert("long");
-    ReservedSet->insert("short");
-    ReservedSet->insert("half");
-    ReservedSet->insert("fixed");
-    ReservedSet->insert("unsigned");
-    ReservedSet->insert("input");
-    ReservedSet->insert("output");
-    ReservedSet->insert("hvec2");
-    ReservedSet->insert("hvec3");
-    ReservedSet->insert("hvec4");
-    ReservedSet->insert("fvec2");
-    ReservedSet->insert("fvec3");
-    ReservedSet->insert("fvec4");
-    ReservedSet->insert("sampler3DRect");
-    ReservedSet->insert("filter");
-    ReservedSet->insert("sizeof");
-    ReservedSet->insert("cast");
-    ReservedSet->insert("namespace");
-    ReservedSet->insert("using");
+    KEYWORD("textureCubeArray",        TEXTURECUBEARRAY);
+    KEYWORD("itextureCubeArray",       ITEXTURECUBEARRAY);
+    KEYWORD("utextureCubeArray",       UTEXTURECUBEARRAY);
+    KEYWORD("samplerCubeArray",        SAMPLERCUBEARRAY);
+    KEYWORD("samplerCubeArrayShadow",  SAMPLERCUBEARRAYSHADOW);
+    KEYWORD("isamplerCubeArray",       ISAMPLERCUBEARRAY);
+    KEYWORD("usamplerCubeArray",       USAMPLERCUBEARRAY);
+    KEYWORD("sampler1DArrayShadow",    SAMPLER1DARRAYSHADOW);
+    KEYWORD("isampler1DArray",         ISAMPLER1DARRAY);
+    KEYWORD("usampler1D",              USAMPLER1D);
+    KEYWORD("isampler1D",              ISAMPLER1D);
+    KEYWORD("usampler1DArray",         USAMPLER1DARRAY);
+    KEYWORD("samplerBuffer",           SAMPLERBUFFER);
+    KEYWORD("isampler2DRect",          ISAMPLER2DRECT);
+    KEYWORD("usampler2DRect",          USAMPLER2DRECT);
+    KEYWORD("isamplerBuffer",          ISAMPLERBUFFER);
+    KEYWORD("usamplerBuffer",          USAMPLERBUFFER);
+    KEYWORD("sampler2DMS",             SAMPLER2DMS);
+    KEYWORD("isampler2DMS",            ISAMPLER2DMS);
+    KEYWORD("usampler2DMS",            USAMPLER2DMS);
+    KEYWORD("sampler2DMSArray",        SAMPLER2DMSARRAY);
+    KEYWORD("isampler2DMSArray",       ISAMPLER2DMSARRAY);
+    KEYWORD("usampler2DMSArray",       USAMPLER2DMSARRAY);
+    KEYWORD("sampler1D",               SAMPLER1D);
+    KEYWORD("sampler1DShadow",         SAMPLER1DSHADOW);
+    KEYWORD("sampler2DRect",           SAMPLER2DRECT);
+    KEYWORD("sampler2DRectShadow",     SAMPLER2DRECTSHADOW);
+    KEYWORD("sampler1DArray",          SAMPLER1DARRAY);
+
+    KEYWORD("samplerExternalOES",      SAMPLEREXTERNALOES); // GL_OES_EGL_image_external
+
+    KEYWORD("__samplerExternal2DY2YEXT", SAMPLEREXTERNAL2DY2YEXT); // GL_EXT_YUV_target
+
+    KEYWORD("itexture1DArray",         ITEXTURE1DARRAY);
+    KEYWORD("utexture1D",              UTEXTURE1D);
+    KEYWORD("itexture1D",              ITEXTURE1D);
+    KEYWORD("utexture1DArray",         UTEXTURE1DARRAY);
+    KEYWORD("textureBuffer",           TEXTUREBUFFER);
+    KEYWORD("itexture2DRect",          ITEXTURE2DRECT);
+    KEYWORD("utexture2DRect",          UTEXTURE2DRECT);
+    KEYWORD("itextureBuffer",          ITEXTUREBUFFER);
+    KEYWORD("utextureBuffer",          UTEXTUREBUFFER);
+    KEYWORD("texture2DMS",             TEXTURE2DMS);
+    KEYWORD("itexture2DMS",            ITEXTURE2DMS);
+    KEYWORD("utexture2DMS",            UTEXTURE2DMS);
+    KEYWORD("texture2DMSArray",        TEXTURE2DMSARRAY);
+    KEYWORD("itexture2DMSArray",       ITEXTURE2DMSARRAY);
+    KEYWORD("utexture2DMSArray",       UTEXTURE2DMSARRAY);
+    KEYWORD("texture1D",               TEXTURE1D);
+    KEYWORD("texture2DRect",           TEXTURE2DRECT);
+    KEYWORD("texture1DArray",          TEXTURE1DARRAY);
+
+    KEYWORD("subpassInput",            SUBPASSINPUT);
+    KEYWORD("subpassInputMS",          SUBPASSINPUTMS);
+    KEYWORD("isubpassInput",           ISUBPASSINPUT);
+    KEYWORD("isubpassInputMS",         ISUBPASSINPUTMS);
+    KEYWORD("usubpassInput",           USUBPASSINPUT);
+    KEYWORD("usubpassInputMS",         USUBPASSINPUTMS);
+
+    KEYWORD("f16sampler1D",            F16SAMPLER1D);
+    KEYWORD("f16sampler2D",            F16SAMPLER2D);
+    KEYWORD("f16sampler3D",            F16SAMPLER3D);
+    KEYWORD("f16sampler2DRect",        F16SAMPLER2DRECT);
+    KEYWORD("f16samplerCube",          F16SAMPLERCUBE);
+    KEYWORD("f16sampler1DArray",       F16SAMPLER1DARRAY);
+    KEYWORD("f16sampler2DArray",       F16SAMPLER2DARRAY);
+    KEYWORD("f16samplerCubeArray",     F16SAMPLERCUBEARRAY);
+    KEYWORD("f16samplerBuffer",        F16SAMPLERBUFFER);
+    KEYWORD("f16sampler2DMS",          F16SAMPLER2DMS);
+    KEYWORD("f16sampler2DMSArray",     F16SAMPLER2DMSARRAY);
+    KEYWORD("f16sampler1DShadow",      F16SAMPLER1DSHADOW);
+    KEYWORD("f16sampler2DShadow",      F16SAMPLER2DSHADOW);
+    KEYWORD("f16sampler2DRectShadow",  F16SAMPLER2DRECTSHADOW);
+    KEYWORD("f16samplerCubeShadow",    F16SAMPLERCUBESHADOW);
+    KEYWORD("f16sampler1DArrayShadow", F16SAMPLER1DARRAYSHADOW);
+    KEYWORD("f16sampler2DArrayShadow", F16SAMPLER2DARRAYSHADOW);
+    KEYWORD("f16samplerCubeArrayShadow", F16SAMPLERCUBEARRAYSHADOW);
+
+    KEYWORD("f16image1D",              F16IMAGE1D);
+    KEYWORD("f16image2D",              F16IMAGE2D);
+    KEYWORD("f16image3D",              F16IMAGE3D);
+    KEYWORD("f16image2DRect",          F16IMAGE2DRECT);
+    KEYWORD("f16imageCube",            F16IMAGECUBE);
+    KEYWORD("f16image1DArray",         F16IMAGE1DARRAY);
+    KEYWORD("f16image2DArray",         F16IMAGE2DARRAY);
+    KEYWORD("f16imageCubeArray",       F16IMAGECUBEARRAY);
+    KEYWORD("f16imageBuffer",          F16IMAGEBUFFER);
+    KEYWORD("f16image2DMS",            F16IMAGE2DMS);
+    KEYWORD("f16image2DMSArray",       F16IMAGE2DMSARRAY);
+
+    KEYWORD("f16texture1D",            F16TEXTURE1D);
+    KEYWORD("f16texture2D",            F16TEXTURE2D);
+    KEYWORD("f16texture3D",            F16TEXTURE3D);
+    KEYWORD("f16texture2DRect",        F16TEXTURE2DRECT);
+    KEYWORD("f16textureCube",          F16TEXTURECUBE);
+    KEYWORD("f16texture1DArray",       F16TEXTURE1DARRAY);
+    KEYWORD("f16texture2DArray",       F16TEXTURE2DARRAY);
+    KEYWORD("f16textureCubeArray",     F16TEXTURECUBEARRAY);
+    KEYWORD("f16textureBuffer",        F16TEXTUREBUFFER);
+    KEYWORD("f16texture2DMS",          F16TEXTURE2DMS);
+    KEYWORD("f16texture2DMSArray",     F16TEXTURE2DMSARRAY);
+
+    KEYWORD("f16subpassInput",         F16SUBPASSINPUT);
+    KEYWORD("f16subpassInputMS",       F16SUBPASSINPUTMS);
+    KEYWORD("__explicitInterpAMD",     EXPLICITINTERPAMD);
+    KEYWORD("pervertexNV",             PERVERTEXNV);
+    KEYWORD("precise",                 PRECISE);
+
+    KEYWORD("rayPayloadNV",            PAYLOADNV);
+    KEYWORD("rayPayloadEXT",           PAYLOADEXT);
+    KEYWORD("rayPayloadInNV",          PAYLOADINNV);
+    KEYWORD("rayPayloadInEXT",         PAYLOADINEXT);
+    KEYWORD("hitAttributeNV",          HITATTRNV);
+    KEYWORD("hitAttributeEXT",         HITATTREXT);
+    KEYWORD("callableDataNV",          CALLDATANV);
+    KEYWORD("callableDataEXT",         CALLDATAEXT);
+    KEYWORD("callableDataInNV",        CALLDATAINNV);
+    KEYWORD("callableDataInEXT",       CALLDATAINEXT);
+    KEYWORD("accelerationStructureNV", ACCSTRUCTNV);
+    KEYWORD("accelerationStructureEXT", ACCSTRUCTEXT);
+    KEYWORD("rayQueryEXT",             RAYQUERYEXT);
+    KEYWORD("perprimitiveNV",          PERPRIMITIVENV);
+    KEYWORD("perviewNV",               PERVIEWNV);
+    KEYWORD("taskNV",                  PERTASKNV);
+
+    KEYWORD("fcoopmatNV",              FCOOPMATNV);
+    KEYWORD("icoopmatNV",              ICOOPMATNV);
+    KEYWORD("ucoopmatNV",              UCOOPMATNV);
 #endif
+
+    default:
+        return 0;
+    }
 }
 
-void TScanContext::deleteKeywordMap()
-{
-    delete KeywordMap;
-    KeywordMap = nullptr;
 #ifndef GLSLANG_WEB
-    delete ReservedSet;
-    ReservedSet = nullptr;
-#endif
+// Returns true if 'text' is a reserved word.
+bool IsReservedWord(const char* text)
+{
+    switch (KeywordHash(text)) {
+    RESERVED("common");
+    RESERVED("partition");
+    RESERVED("active");
+    RESERVED("asm");
+    RESERVED("class");
+    RESERVED("union");
+    RESERVED("enum");
+    RESERVED("typedef");
+    RESERVED("template");
+    RESERVED("this");
+    RESERVED("goto");
+    RESERVED("inline");
+    RESERVED("noinline");
+    RESERVED("public");
+    RESERVED("static");
+    RESERVED("extern");
+    RESERVED("external");
+    RESERVED("interface");
+    RESERVED("long");
+    RESERVED("short");
+    RESERVED("half");
+    RESERVED("fixed");
+    RESERVED("unsigned");
+    RESERVED("input");
+    RESERVED("output");
+    RESERVED("hvec2");
+    RESERVED("hvec3");
+    RESERVED("hvec4");
+    RESERVED("fvec2");
+    RESERVED("fvec3");
+    RESERVED("fvec4");
+    RESERVED("sampler3DRect");
+    RESERVED("filter");
+    RESERVED("sizeof");
+    RESERVED("cast");
+    RESERVED("namespace");
+    RESERVED("using");
+
+    default:
+        return false;
+    }
 }
+#endif
+
+#undef KEYWORD
+#undef RESERVED
+
+} // end anonymous namespace
+
+namespace glslang {
 
 // Called by yylex to get the next token.
 // Returning 0 implies end of input.
@@ -885,16 +1128,15 @@ int TScanContext::tokenize(TPpContext* pp, TParserToken& token)
 int TScanContext::tokenizeIdentifier()
 {
 #ifndef GLSLANG_WEB
-    if (ReservedSet->find(tokenText) != ReservedSet->end())
+    if (IsReservedWord(tokenText))
         return reservedWord();
 #endif
 
-    auto it = KeywordMap->find(tokenText);
-    if (it == KeywordMap->end()) {
+    keyword = KeywordToken(tokenText);
+    if (keyword == 0) {
         // Should have an identifier of some sort
         return identifierOrType();
     }
-    keyword = it->second;
 
     switch (keyword) {
     case CONST:
@@ -1094,7 +1336,7 @@ int TScanContext::tokenizeIdentifier()
     case LAYOUT:
     {
         const int numLayoutExts = 2;
-        const char* layoutExts[numLayoutExts] = { E_GL_ARB_shading_language_420pack,
+        const TExtension layoutExts[numLayoutExts] = { E_GL_ARB_shading_language_420pack,
                                                   E_GL_ARB_explicit_attrib_location };
         if ((parseContext.isEsProfile() && parseContext.version < 300) ||
             (!parseContext.isEsProfile() && parseContext.version < 140 &&
@@ -218,6 +218,35 @@ public:
     // Returns the index (starting from 0) of the most recent valid source string we are reading from.
     int getLastValidSourceIndex() const { return std::min(currentSource, numSources - 1); }
 
+    // Where the next character comes from: its string, and its offset in that string.
+    int getCurrentSource() const { return currentSource; }
+    size_t getCurrentChar() const { return currentChar; }
+
+    // Move past 'count' characters of the current string, already known, from an
+    // earlier scan of the same text, to hold 'newlines' newlines and to leave the
+    // location at 'column'.  The characters must not reach the end of the string.
+    void skipInString(size_t count, int newlines, int column)
+    {
+        if (newlines == 0)
+            loc[currentSource].column += column - logicalSourceLoc.column;
+        else {
+            loc[currentSource].line += newlines;
+            logicalSourceLoc.line += newlines;
+            loc[currentSource].column = column;
+        }
+        logicalSourceLoc.column = column;
+        currentChar += count;
+    }
+
+    // Bulk versions of get(), for long runs of characters: each consumes the
+    // run starting at the next character, keeping locations exactly as get()
+    // would, and returns the run's length, which may be 0.  Runs stop at the end
+    // of the current string, to go on from with get().
+    size_t getSpaces();                              // ' ' and '\t'
+    size_t getLineCommentText();                     // anything but '\n', '\r' and '\\'
+    size_t getBlockCommentText();                    // anything but '*' and '\\'
+    const char* getIdentifierText(size_t& length);   // letters, digits and '_'
+
     void consumeWhiteSpace(bool& foundNonSpaceTab);
     bool consumeComment();
     void consumeWhitespaceComment(bool& foundNonSpaceTab);
@@ -225,6 +254,9 @@ public:
 
 protected:
 
+    const unsigned char* unreadInString(size_t& length) const;
+    void advanceInString(size_t count, int newlines, size_t lastNewline);
+
     // advance one character
     void advance()
     {
@@ -56,9 +56,6 @@ public:
         field(false), afterBuffer(false) { }
     virtual ~TScanContext() { }
 
-    static void fillInKeywordMap();
-    static void deleteKeywordMap();
-
     int tokenize(TPpContext*, TParserToken&);
 
 protected:
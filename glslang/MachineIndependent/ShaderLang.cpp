@@ -41,11 +41,19 @@
 // This is the platform independent interface between an OGL driver
 // and the shading language compiler/linker.
 //
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <cstring>
 #include <iostream>
 #include <sstream>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include "SymbolTable.h"
+#include "SymbolTableSnapshot.h"
+#include "Hash.h"
 #include "ParseHelper.h"
 #include "Scan.h"
 #include "ScanContext.h"
@@ -226,7 +234,53 @@ enum EPrecisionClass {
 TSymbolTable* CommonSymbolTable[VersionCount][SpvVersionCount][ProfileCount][SourceCount][EPcCount] = {};
 TSymbolTable* SharedSymbolTables[VersionCount][SpvVersionCount][ProfileCount][SourceCount][EShLangCount] = {};
 
-TPoolAllocator* PerProcessGPA = nullptr;
+// A remembered context-specific (resource-dependent) built-in level for one stage,
+// sitting on top of the shared levels for that stage, for all compiles using the
+// same resources to copy instead of parsing it again.
+//
+struct TContextSymbolTable {
+    EShLanguage stage;
+    unsigned int hash;              // of 'resources', to quickly skip non-matches
+    TBuiltInResource resources;     // just the limits the built-ins depend on are compared
+    TSymbolTable* table;            // the shared levels, plus the context-specific level to copy
+    TContextSymbolTable* next;
+};
+
+// To not grow without bound for a client that uses ever-changing resources.
+const int MaxContextSymbolTables = 32;
+
+// Set-up state for the tables above, one per version/profile combination.
+//
+// Each combination is set up at most once, by whichever thread first needs it,
+// while holding only that combination's mutex, into that combination's own pool.
+// So, different combinations can be set up in parallel.  Once 'ready' is set,
+// the tables are never changed again (until ShFinalize()) and are read without locking.
+//
+struct TBuiltinSlot {
+    TBuiltinSlot() : ready(false), pool(nullptr), contextTables(nullptr), contextTableCount(0), contextPool(nullptr) { }
+
+    std::atomic<bool> ready;
+    std::mutex mutex;
+    TPoolAllocator* pool;  // holds the tables, once set up
+
+    // Context-specific tables are added, under 'mutex', after the slot is ready,
+    // to the front of the list; the list is read without locking.
+    std::atomic<TContextSymbolTable*> contextTables;
+    int contextTableCount;
+    TPoolAllocator* contextPool;  // holds the context-specific tables
+};
+
+TBuiltinSlot BuiltinSlots[VersionCount][SpvVersionCount][ProfileCount][SourceCount];
+
+#ifndef GLSLANG_WEB
+// Where to load built-in symbol table snapshots from and save them to; empty
+// when snapshots are not in use.  Protected by the global lock.
+std::string BuiltinSnapshotDirectory;
+
+// Snapshots in memory, e.g., made at build time, looked for before the directory.
+// Protected by the global lock.
+std::vector<TBuiltinSnapshot> BuiltinSnapshots;
+#endif
 
 //
 // Parse and add to the given symbol table the content of the given shader string.
@@ -307,7 +361,11 @@ void InitializeStageSymbolTable(TBuiltInParseables& builtInParseables, int versi
 // Initialize the full set of shareable symbol tables;
 // The common (cross-stage) and those shareable per-stage.
 //
-bool InitializeSymbolTables(TInfoSink& infoSink, TSymbolTable** commonTable,  TSymbolTable** symbolTables, int version, EProfile profile, const SpvVersion& spvVersion, EShSource source)
+// The tables are built in 'tablePool'.  The text of the built-ins is made
+// in the current pool, so it can be thrown away independently.
+//
+bool InitializeSymbolTables(TInfoSink& infoSink, TSymbolTable** commonTable,  TSymbolTable** symbolTables, int version, EProfile profile, const SpvVersion& spvVersion, EShSource source,
+                            TPoolAllocator& tablePool)
 {
 #ifdef GLSLANG_WEB
     profile = EEsProfile;
@@ -319,7 +377,10 @@ bool InitializeSymbolTables(TInfoSink& infoSink, TSymbolTable** commonTable,  TS
     if (builtInParseables == nullptr)
         return false;
 
+    // the strings keep allocating from the pool they were made in
     builtInParseables->initialize(version, profile, spvVersion);
+    TPoolAllocator& textPool = GetThreadPoolAllocator();
+    SetThreadPoolAllocator(&tablePool);
 
     // do the common tables
     InitializeSymbolTable(builtInParseables->getCommonString(), version, profile, spvVersion, EShLangVertex, source,
@@ -387,11 +448,18 @@ bool InitializeSymbolTables(TInfoSink& infoSink, TSymbolTable** commonTable,  TS
         InitializeStageSymbolTable(*builtInParseables, version, profile, spvVersion, EShLangTaskNV, source,
                                    infoSink, commonTable, symbolTables);
 
+    SetThreadPoolAllocator(&textPool);
+
     return true;
 }
 
+//
+// Add the context-specific level, built in 'tablePool', with the text of the
+// built-ins made in the current pool.
+//
 bool AddContextSpecificSymbols(const TBuiltInResource* resources, TInfoSink& infoSink, TSymbolTable& symbolTable, int version,
-                               EProfile profile, const SpvVersion& spvVersion, EShLanguage language, EShSource source)
+                               EProfile profile, const SpvVersion& spvVersion, EShLanguage language, EShSource source,
+                               TPoolAllocator& tablePool)
 {
     std::unique_ptr<TBuiltInParseables> builtInParseables(CreateBuiltInParseables(infoSink, source));
 
@@ -399,19 +467,255 @@ bool AddContextSpecificSymbols(const TBuiltInResource* resources, TInfoSink& inf
         return false;
 
     builtInParseables->initialize(*resources, version, profile, spvVersion, language);
+    TPoolAllocator& textPool = GetThreadPoolAllocator();
+    SetThreadPoolAllocator(&tablePool);
+    TPoolCategoryScope category(EPoolSymbolTable);
     InitializeSymbolTable(builtInParseables->getCommonString(), version, profile, spvVersion, language, source, infoSink, symbolTable);
     builtInParseables->identifyBuiltIns(version, profile, spvVersion, language, symbolTable, *resources);
+    SetThreadPoolAllocator(&textPool);
+
+    return true;
+}
+
+//
+// The context-specific built-ins depend on all the resources except the
+// 'limits', which only affect the checking of the shader itself.  The
+// resources before 'limits' are all ints, so they can be compared as bytes.
+//
+const size_t ContextResourcesSize = offsetof(TBuiltInResource, limits);
+
+unsigned int HashContextResources(const TBuiltInResource& resources)
+{
+    return HashFnv(FnvBasis, &resources, ContextResourcesSize);
+}
+
+TSymbolTable* FindContextSymbolTable(TContextSymbolTable* list, EShLanguage language, unsigned int hash,
+                                     const TBuiltInResource& resources)
+{
+    for (; list != nullptr; list = list->next) {
+        if (list->stage == language && list->hash == hash &&
+            memcmp(&list->resources, &resources, ContextResourcesSize) == 0)
+            return list->table;
+    }
+
+    return nullptr;
+}
+
+//
+// Get the symbol table holding all the built-in levels for a compile with the
+// given resources, making the context-specific level the first time these
+// resources are seen.  This must be after SetupBuiltinSymbolTable().
+//
+// The context-specific level is not shared as is, because compiles edit it
+// (e.g., implicitly sizing a member of a block), so each compile copies it with
+// copyTable().
+//
+// Returns nullptr if the table could not be remembered, and the compile has to
+// add its own context-specific level.
+//
+TSymbolTable* GetContextSymbolTable(const TBuiltInResource& resources, TInfoSink& infoSink, int version, EProfile profile,
+                                    const SpvVersion& spvVersion, EShLanguage language, EShSource source)
+{
+    int versionIndex = MapVersionToIndex(version);
+    int spvVersionIndex = MapSpvVersionToIndex(spvVersion);
+    int profileIndex = MapProfileToIndex(profile);
+    int sourceIndex = MapSourceToIndex(source);
+    TBuiltinSlot& slot = BuiltinSlots[versionIndex][spvVersionIndex][profileIndex][sourceIndex];
+    unsigned int hash = HashContextResources(resources);
+
+    TSymbolTable* table = FindContextSymbolTable(slot.contextTables.load(std::memory_order_acquire), language, hash,
+                                                 resources);
+    if (table != nullptr)
+        return table;
+
+    // Another thread might be adding the same one; check again once it's done.
+    std::lock_guard<std::mutex> guard(slot.mutex);
+    table = FindContextSymbolTable(slot.contextTables.load(std::memory_order_relaxed), language, hash, resources);
+    if (table != nullptr)
+        return table;
+    if (slot.contextTableCount == MaxContextSymbolTables)
+        return nullptr;
+
+    if (slot.contextPool == nullptr)
+        slot.contextPool = new TPoolAllocator;
+
+    table = new TSymbolTable;
+    TSymbolTable* sharedTable = SharedSymbolTables[versionIndex][spvVersionIndex][profileIndex][sourceIndex][language];
+    if (sharedTable)
+        table->adoptLevels(*sharedTable);
+    if (! AddContextSpecificSymbols(&resources, infoSink, *table, version, profile, spvVersion, language, source,
+                                    *slot.contextPool)) {
+        delete table;
+        return nullptr;
+    }
+
+    TContextSymbolTable* entry = new TContextSymbolTable;
+    entry->stage = language;
+    entry->hash = hash;
+    entry->resources = resources;
+    entry->table = table;
+    entry->next = slot.contextTables.load(std::memory_order_relaxed);
+    slot.contextTables.store(entry, std::memory_order_release);
+    ++slot.contextTableCount;
+
+    return table;
+}
+
+#ifndef GLSLANG_WEB
+
+std::string GetBuiltinSnapshotDirectory()
+{
+    glslang::GetGlobalLock();
+    std::string directory = BuiltinSnapshotDirectory;
+    glslang::ReleaseGlobalLock();
+
+    return directory;
+}
+
+std::string BuiltinSnapshotName(int versionIndex, int spvVersionIndex, int profileIndex, int sourceIndex)
+{
+    std::ostringstream name;
+    name << "builtins-" << versionIndex << "-" << spvVersionIndex << "-" << profileIndex << "-" << sourceIndex << ".bin";
+
+    return name.str();
+}
+
+std::string BuiltinSnapshotPath(const std::string& directory, int versionIndex, int spvVersionIndex, int profileIndex,
+                                int sourceIndex)
+{
+    return directory + "/" + BuiltinSnapshotName(versionIndex, spvVersionIndex, profileIndex, sourceIndex);
+}
+
+//
+// Try to fill in the process-global tables for one version/profile combination
+// from the given snapshot, made by SaveBuiltinSnapshot() in this or an earlier
+// process, or at build time.  Must be called with the pool meant to hold the
+// tables current.
+//
+// Returns false, leaving the tables untouched, if the snapshot is not usable.
+//
+bool ReadBuiltinSnapshot(const unsigned char* data, size_t size, int versionIndex, int spvVersionIndex, int profileIndex,
+                         int sourceIndex, EProfile profile)
+{
+    TSymbolTableSnapshotReader reader(data, size);
+    if (! reader.readHeader())
+        return false;
+
+    TSymbolTable* commonTable[EPcCount] = {};
+    TSymbolTable* stageTables[EShLangCount] = {};
+    bool success = true;
+    for (int precClass = 0; precClass < EPcCount && success; ++precClass)
+        success = reader.readTable(commonTable[precClass], nullptr);
+    for (int stage = 0; stage < EShLangCount && success; ++stage) {
+        TSymbolTable* common = commonTable[CommonIndex(profile, (EShLanguage)stage)];
+        success = common != nullptr && reader.readTable(stageTables[stage], common);
+    }
+    if (! success || commonTable[EPcGeneral] == nullptr) {
+        for (int stage = 0; stage < EShLangCount; ++stage)
+            delete stageTables[stage];
+        for (int precClass = 0; precClass < EPcCount; ++precClass)
+            delete commonTable[precClass];
+
+        return false;
+    }
+
+    for (int precClass = 0; precClass < EPcCount; ++precClass) {
+        if (commonTable[precClass] != nullptr)
+            commonTable[precClass]->readOnly();
+        CommonSymbolTable[versionIndex][spvVersionIndex][profileIndex][sourceIndex][precClass] = commonTable[precClass];
+    }
+    for (int stage = 0; stage < EShLangCount; ++stage) {
+        if (stageTables[stage] != nullptr)
+            stageTables[stage]->readOnly();
+        SharedSymbolTables[versionIndex][spvVersionIndex][profileIndex][sourceIndex][stage] = stageTables[stage];
+    }
 
     return true;
 }
 
+//
+// Same as ReadBuiltinSnapshot(), for the snapshot given by SetBuiltinSnapshots(),
+// if there is one.
+//
+bool LoadBuiltinSnapshot(int versionIndex, int spvVersionIndex, int profileIndex, int sourceIndex, EProfile profile)
+{
+    std::string name = BuiltinSnapshotName(versionIndex, spvVersionIndex, profileIndex, sourceIndex);
+    const TBuiltinSnapshot* snapshot = nullptr;
+    glslang::GetGlobalLock();
+    for (size_t s = 0; s < BuiltinSnapshots.size() && snapshot == nullptr; ++s) {
+        if (name == BuiltinSnapshots[s].name)
+            snapshot = &BuiltinSnapshots[s];
+    }
+    // the snapshot's contents stay valid, even if the list changes
+    const unsigned char* data = snapshot != nullptr ? snapshot->data : nullptr;
+    size_t size = snapshot != nullptr ? snapshot->size : 0;
+    glslang::ReleaseGlobalLock();
+
+    return data != nullptr &&
+           ReadBuiltinSnapshot(data, size, versionIndex, spvVersionIndex, profileIndex, sourceIndex, profile);
+}
+
+//
+// Same as ReadBuiltinSnapshot(), for the snapshot file in 'directory', if there is one.
+//
+bool LoadBuiltinSnapshot(const std::string& directory, int versionIndex, int spvVersionIndex, int profileIndex,
+                         int sourceIndex, EProfile profile)
+{
+    FILE* file = fopen(BuiltinSnapshotPath(directory, versionIndex, spvVersionIndex, profileIndex, sourceIndex).c_str(), "rb");
+    if (file == nullptr)
+        return false;
+
+    std::vector<unsigned char> data;
+    bool readOk = fseek(file, 0, SEEK_END) == 0;
+    long size = readOk ? ftell(file) : -1;
+    if (size > 0 && fseek(file, 0, SEEK_SET) == 0) {
+        data.resize(size);
+        readOk = fread(data.data(), 1, data.size(), file) == data.size();
+    } else
+        readOk = false;
+    fclose(file);
+
+    return readOk &&
+           ReadBuiltinSnapshot(data.data(), data.size(), versionIndex, spvVersionIndex, profileIndex, sourceIndex, profile);
+}
+
+//
+// Save the process-global tables for one version/profile combination, for
+// LoadBuiltinSnapshot() to pick up in later processes.  Failing to save is
+// not an error; the tables will just be generated again next time.
+//
+void SaveBuiltinSnapshot(const std::string& directory, int versionIndex, int spvVersionIndex, int profileIndex,
+                         int sourceIndex)
+{
+    std::vector<unsigned char> data;
+    TSymbolTableSnapshotWriter writer(data);
+    for (int precClass = 0; precClass < EPcCount; ++precClass)
+        writer.writeTable(CommonSymbolTable[versionIndex][spvVersionIndex][profileIndex][sourceIndex][precClass]);
+    for (int stage = 0; stage < EShLangCount; ++stage)
+        writer.writeTable(SharedSymbolTables[versionIndex][spvVersionIndex][profileIndex][sourceIndex][stage]);
+    if (! writer.finish())
+        return;
+
+    // Write to the side and move into place, so a concurrent reader never sees a partial file.
+    std::string path = BuiltinSnapshotPath(directory, versionIndex, spvVersionIndex, profileIndex, sourceIndex);
+    std::string tempPath = path + ".tmp";
+    FILE* file = fopen(tempPath.c_str(), "wb");
+    if (file == nullptr)
+        return;
+    bool written = fwrite(data.data(), 1, data.size(), file) == data.size();
+    written = fclose(file) == 0 && written;
+    if (! written || rename(tempPath.c_str(), path.c_str()) != 0)
+        remove(tempPath.c_str());
+}
+
+#endif
+
 //
 // To do this on the fly, we want to leave the current state of our thread's
 // pool allocator intact, so:
-//  - Switch to a new pool for parsing the built-ins
-//  - Do the parsing, which builds the symbol table, using the new pool
-//  - Switch to the process-global pool to save a copy of the resulting symbol table
-//  - Free up the new pool used to parse the built-ins
+//  - Switch to a new pool for generating the text of the built-ins
+//  - Do the parsing, which builds the symbol table, using the combination's pool
+//  - Free up the new pool used for the text
 //  - Switch back to the original thread's pool
 //
 // This only gets done the first time any thread needs a particular symbol table
@@ -419,28 +723,48 @@ bool AddContextSpecificSymbols(const TBuiltInResource* resources, TInfoSink& inf
 //
 void SetupBuiltinSymbolTable(int version, EProfile profile, const SpvVersion& spvVersion, EShSource source)
 {
-    TInfoSink infoSink;
-
-    // Make sure only one thread tries to do this at a time
-    glslang::GetGlobalLock();
-
-    // See if it's already been done for this version/profile combination
     int versionIndex = MapVersionToIndex(version);
     int spvVersionIndex = MapSpvVersionToIndex(spvVersion);
     int profileIndex = MapProfileToIndex(profile);
     int sourceIndex = MapSourceToIndex(source);
-    if (CommonSymbolTable[versionIndex][spvVersionIndex][profileIndex][sourceIndex][EPcGeneral]) {
-        glslang::ReleaseGlobalLock();
+    TBuiltinSlot& slot = BuiltinSlots[versionIndex][spvVersionIndex][profileIndex][sourceIndex];
 
+    // See if it's already been done for this version/profile combination
+    if (slot.ready.load(std::memory_order_acquire))
+        return;
+
+    // Make sure only one thread tries to do this combination at a time
+    std::lock_guard<std::mutex> guard(slot.mutex);
+    if (slot.ready.load(std::memory_order_relaxed))
         return;
-    }
 
-    // Switch to a new pool
+    TInfoSink infoSink;
     TPoolAllocator& previousAllocator = GetThreadPoolAllocator();
+    if (slot.pool == nullptr)
+        slot.pool = new TPoolAllocator;
+
+#ifndef GLSLANG_WEB
+    // See if the work was already done at build time, or by an earlier process
+    std::string snapshotDirectory = GetBuiltinSnapshotDirectory();
+    SetThreadPoolAllocator(slot.pool);
+    bool loaded = LoadBuiltinSnapshot(versionIndex, spvVersionIndex, profileIndex, sourceIndex, profile) ||
+                  (! snapshotDirectory.empty() &&
+                   LoadBuiltinSnapshot(snapshotDirectory, versionIndex, spvVersionIndex, profileIndex, sourceIndex,
+                                       profile));
+    SetThreadPoolAllocator(&previousAllocator);
+    if (loaded) {
+        slot.ready.store(true, std::memory_order_release);
+
+        return;
+    }
+#endif
+
+    // Switch to a new pool for the scratch work
     TPoolAllocator* builtInPoolAllocator = new TPoolAllocator;
     SetThreadPoolAllocator(builtInPoolAllocator);
 
-    // Dynamically allocate the local symbol tables so we can control when they are deallocated WRT when the pool is popped.
+    // Generate the symbol tables right into the combination's pool; they are never
+    // modified after this, so compiles can share them, as is, without copying.
     TSymbolTable* commonTable[EPcCount];
     TSymbolTable* stageTables[EShLangCount];
     for (int precClass = 0; precClass < EPcCount; ++precClass)
@@ -448,40 +772,32 @@ void SetupBuiltinSymbolTable(int version, EProfile profile, const SpvVersion& sp
     for (int stage = 0; stage < EShLangCount; ++stage)
         stageTables[stage] = new TSymbolTable;
 
-    // Generate the local symbol tables using the new pool
-    InitializeSymbolTables(infoSink, commonTable, stageTables, version, profile, spvVersion, source);
-
-    // Switch to the process-global pool
-    SetThreadPoolAllocator(PerProcessGPA);
+    InitializeSymbolTables(infoSink, commonTable, stageTables, version, profile, spvVersion, source, *slot.pool);
 
-    // Copy the local symbol tables from the new pool to the global tables using the process-global pool
     for (int precClass = 0; precClass < EPcCount; ++precClass) {
         if (! commonTable[precClass]->isEmpty()) {
-            CommonSymbolTable[versionIndex][spvVersionIndex][profileIndex][sourceIndex][precClass] = new TSymbolTable;
-            CommonSymbolTable[versionIndex][spvVersionIndex][profileIndex][sourceIndex][precClass]->copyTable(*commonTable[precClass]);
-            CommonSymbolTable[versionIndex][spvVersionIndex][profileIndex][sourceIndex][precClass]->readOnly();
-        }
+            commonTable[precClass]->readOnly();
+            CommonSymbolTable[versionIndex][spvVersionIndex][profileIndex][sourceIndex][precClass] = commonTable[precClass];
+        } else
+            delete commonTable[precClass];
     }
     for (int stage = 0; stage < EShLangCount; ++stage) {
         if (! stageTables[stage]->isEmpty()) {
-            SharedSymbolTables[versionIndex][spvVersionIndex][profileIndex][sourceIndex][stage] = new TSymbolTable;
-            SharedSymbolTables[versionIndex][spvVersionIndex][profileIndex][sourceIndex][stage]->adoptLevels(*CommonSymbolTable
-                              [versionIndex][spvVersionIndex][profileIndex][sourceIndex][CommonIndex(profile, (EShLanguage)stage)]);
-            SharedSymbolTables[versionIndex][spvVersionIndex][profileIndex][sourceIndex][stage]->copyTable(*stageTables[stage]);
-            SharedSymbolTables[versionIndex][spvVersionIndex][profileIndex][sourceIndex][stage]->readOnly();
-        }
+            stageTables[stage]->readOnly();
+            SharedSymbolTables[versionIndex][spvVersionIndex][profileIndex][sourceIndex][stage] = stageTables[stage];
+        } else
+            delete stageTables[stage];
     }
 
-    // Clean up the local tables before deleting the pool they used.
-    for (int precClass = 0; precClass < EPcCount; ++precClass)
-        delete commonTable[precClass];
-    for (int stage = 0; stage < EShLangCount; ++stage)
-        delete stageTables[stage];
-
     delete builtInPoolAllocator;
     SetThreadPoolAllocator(&previousAllocator);
 
-    glslang::ReleaseGlobalLock();
+#ifndef GLSLANG_WEB
+    if (! snapshotDirectory.empty())
+        SaveBuiltinSnapshot(snapshotDirectory, versionIndex, spvVersionIndex, profileIndex, sourceIndex);
+#endif
+
+    slot.ready.store(true, std::memory_order_release);
 }
 
 // Function to Print all builtins
@@ -809,6 +1125,9 @@ bool ProcessDeferred(
     // This must be undone (.pop()) by the caller, after it finishes consuming the created tree.
     GetThreadPoolAllocator().push();
 
+    // Nodes of the tree share their types.
+    TTypeTableScope typeTable;
+
     if (numStrings == 0)
         return true;
 
@@ -936,9 +1255,14 @@ bool ProcessDeferred(
         symbolTable->adoptLevels(*cachedTable);
 
     // Add built-in symbols that are potentially context dependent;
-    // they get popped again further down.
-    if (! AddContextSpecificSymbols(resources, compiler->infoSink, *symbolTable, version, profile, spvVersion,
-                                    stage, source)) {
+    // they get popped again further down.  Copy them from an earlier compile
+    // using the same resources, when possible.
+    TSymbolTable* contextTable = GetContextSymbolTable(*resources, compiler->infoSink, version, profile, spvVersion,
+                                                       stage, source);
+    if (contextTable)
+        symbolTable->copyTable(*contextTable);
+    else if (! AddContextSpecificSymbols(resources, compiler->infoSink, *symbolTable, version, profile, spvVersion,
+                                         stage, source, GetThreadPoolAllocator())) {
         return false;
     }
 
@@ -1263,6 +1587,99 @@ bool PreprocessDeferred(
                            forwardCompatible, messages, intermediate, parser,
                            false, includer);
 }
+
+//
+// Support for TShader::PreprocessCache.  Keys and include hashes are 64-bit
+// FNV-1a, as they are kept by the application, possibly across runs, and
+// trusted without comparing what they hash.
+//
+template<typename T>
+unsigned long long HashPreprocessValue(unsigned long long hash, const T& value)
+{
+    return HashFnv64(hash, &value, sizeof(value));
+}
+
+// Hash a string that might be null, keeping its bounds.
+unsigned long long HashPreprocessString(unsigned long long hash, const char* string, size_t length)
+{
+    hash = HashPreprocessValue(hash, string != nullptr);
+    hash = HashPreprocessValue(hash, length);
+
+    return string != nullptr ? HashFnv64(hash, string, length) : hash;
+}
+
+// The hash of an Includer result: a failure hashes as its error details.
+unsigned long long HashIncludeResult(const TShader::Includer::IncludeResult* result)
+{
+    if (result == nullptr)
+        return HashPreprocessString(FnvBasis64, nullptr, 0);
+
+    unsigned long long hash = HashPreprocessString(FnvBasis64, result->headerName.c_str(),
+                                                   result->headerName.size());
+    return HashPreprocessString(hash, result->headerData, result->headerLength);
+}
+
+// An Includer passing requests on to another, noting each request and the hash
+// of its result.
+class TRecordingIncluder : public TShader::Includer {
+public:
+    TRecordingIncluder(TShader::Includer& includer, std::vector<TShader::PreprocessCache::Include>& includes)
+        : includer(includer), includes(includes) { }
+
+    virtual IncludeResult* includeSystem(const char* headerName, const char* includerName,
+                                         size_t inclusionDepth) override
+    {
+        return record(includer.includeSystem(headerName, includerName, inclusionDepth),
+                      headerName, includerName, inclusionDepth, true);
+    }
+    virtual IncludeResult* includeLocal(const char* headerName, const char* includerName,
+                                        size_t inclusionDepth) override
+    {
+        return record(includer.includeLocal(headerName, includerName, inclusionDepth),
+                      headerName, includerName, inclusionDepth, false);
+    }
+    virtual void releaseInclude(IncludeResult* result) override { includer.releaseInclude(result); }
+
+protected:
+    IncludeResult* record(IncludeResult* result, const char* headerName, const char* includerName,
+                          size_t inclusionDepth, bool system)
+    {
+        TShader::PreprocessCache::Include include;
+        include.headerName = headerName;
+        include.includerName = includerName;
+        include.inclusionDepth = inclusionDepth;
+        include.system = system;
+        include.hash = HashIncludeResult(result);
+        includes.push_back(include);
+
+        return result;
+    }
+
+    TShader::Includer& includer;
+    std::vector<TShader::PreprocessCache::Include>& includes;
+
+private:
+    TRecordingIncluder& operator=(TRecordingIncluder&);
+};
+
+// Whether the Includer still gives the same results for all the requests made
+// when preprocessing a cached entry.  Preprocessing makes each request from
+// what the results of the requests before it held, so when those are the same,
+// so is the sequence of requests.
+bool IncludesUnchanged(const std::vector<TShader::PreprocessCache::Include>& includes, TShader::Includer& includer)
+{
+    for (const auto& include : includes) {
+        TShader::Includer::IncludeResult* result = include.system ?
+            includer.includeSystem(include.headerName.c_str(), include.includerName.c_str(), include.inclusionDepth) :
+            includer.includeLocal(include.headerName.c_str(), include.includerName.c_str(), include.inclusionDepth);
+        unsigned long long hash = HashIncludeResult(result);
+        includer.releaseInclude(result);
+        if (hash != include.hash)
+            return false;
+    }
+
+    return true;
+}
 #endif
 
 //
@@ -1319,10 +1736,9 @@ int ShInitialize()
     ++NumberOfClients;
     glslang::ReleaseGlobalLock();
 
-    if (PerProcessGPA == nullptr)
-        PerProcessGPA = new TPoolAllocator();
-
-    glslang::TScanContext::fillInKeywordMap();
+#ifndef GLSLANG_WEB
+    glslang::TParseVersions::fillInExtensionMap();
+#endif
 #ifdef ENABLE_HLSL
     glslang::HlslScanContext::fillInKeywordMap();
 #endif
@@ -1419,12 +1835,30 @@ int ShFinalize()
         }
     }
 
-    if (PerProcessGPA != nullptr) {
-        delete PerProcessGPA;
-        PerProcessGPA = nullptr;
+    for (int version = 0; version < VersionCount; ++version) {
+        for (int spvVersion = 0; spvVersion < SpvVersionCount; ++spvVersion) {
+            for (int p = 0; p < ProfileCount; ++p) {
+                for (int source = 0; source < SourceCount; ++source) {
+                    TBuiltinSlot& slot = BuiltinSlots[version][spvVersion][p][source];
+                    TContextSymbolTable* entry = slot.contextTables.load();
+                    while (entry != nullptr) {
+                        TContextSymbolTable* next = entry->next;
+                        delete entry->table;
+                        delete entry;
+                        entry = next;
+                    }
+                    slot.contextTables.store(nullptr);
+                    slot.contextTableCount = 0;
+                    delete slot.contextPool;
+                    slot.contextPool = nullptr;
+                    delete slot.pool;
+                    slot.pool = nullptr;
+                    slot.ready.store(false);
+                }
+            }
+        }
     }
 
-    glslang::TScanContext::deleteKeywordMap();
 #ifdef ENABLE_HLSL
     glslang::HlslScanContext::deleteKeywordMap();
 #endif
@@ -1714,6 +2148,125 @@ void FinalizeProcess()
     ShFinalize();
 }
 
+#ifndef GLSLANG_WEB
+
+namespace {
+
+bool PrewarmBuiltin(TBuiltinConfiguration& configuration)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    // Sort out the versions the same way ProcessDeferred() does.
+    EShMessages messages = configuration.messages;
+    EShSource source = (messages & EShMsgReadHlsl) != 0 ? EShSourceHlsl : EShSourceGlsl;
+    EShLanguage stage = configuration.stage;
+    SpvVersion spvVersion;
+    TranslateEnvironment(&configuration.environment, messages, source, stage, spvVersion);
+#ifndef ENABLE_HLSL
+    source = EShSourceGlsl;
+#endif
+    int version = configuration.version;
+    EProfile profile = configuration.profile;
+    TInfoSink infoSink;
+    bool goodVersion = DeduceVersionProfile(infoSink, stage, false, configuration.version, source, version, profile,
+                                            spvVersion);
+
+    SetupBuiltinSymbolTable(version, profile, spvVersion, source);
+    if (configuration.resources != nullptr)
+        GetContextSymbolTable(*configuration.resources, infoSink, version, profile, spvVersion, stage, source);
+
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    configuration.milliseconds = elapsed.count();
+
+    return goodVersion;
+}
+
+} // end anonymous namespace
+
+bool PrewarmBuiltins(TBuiltinConfiguration* configurations, int count, int threads)
+{
+    if (threads <= 0)
+        threads = std::max(1, (int)std::thread::hardware_concurrency());
+    threads = std::min(threads, count);
+
+    std::atomic<int> nextConfiguration(0);
+    std::atomic<bool> success(true);
+    auto work = [&]() {
+        // a pool for the scratch work of setting up
+        InitThread();
+        TPoolAllocator pool;
+        SetThreadPoolAllocator(&pool);
+
+        for (int c = nextConfiguration++; c < count; c = nextConfiguration++) {
+            if (! PrewarmBuiltin(configurations[c]))
+                success = false;
+        }
+
+        SetThreadPoolAllocator(nullptr);
+    };
+
+    // Leave the calling thread's pool alone, by doing all the work on new threads.
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t)
+        workers.push_back(std::thread(work));
+    for (auto& worker : workers)
+        worker.join();
+
+    return success;
+}
+
+void SetBuiltinSnapshotDirectory(const char* directory)
+{
+    glslang::GetGlobalLock();
+    BuiltinSnapshotDirectory = directory != nullptr ? directory : "";
+    glslang::ReleaseGlobalLock();
+}
+
+void SetBuiltinSnapshots(const TBuiltinSnapshot* snapshots, int count)
+{
+    glslang::GetGlobalLock();
+    BuiltinSnapshots.assign(snapshots, snapshots + count);
+    glslang::ReleaseGlobalLock();
+}
+#endif
+
+void GetPoolStatistics(TPoolStatistics& statistics)
+{
+    TPoolAllocator::getCounters(statistics.pagesLive, statistics.pagesCached, statistics.bytesAllocated);
+}
+
+void SetPoolPageCacheLimit(size_t bytes)
+{
+    TPoolAllocator::setPageCacheLimit(bytes);
+}
+
+void SetPoolHugePages(bool hugePages)
+{
+    TPoolAllocator::setHugePages(hugePages);
+}
+
+namespace {
+
+TMemoryUsage ToMemoryUsage(const TPoolUsage& poolUsage)
+{
+    TMemoryUsage usage;
+    usage.current = poolUsage.current;
+    usage.peak = poolUsage.peak;
+
+    return usage;
+}
+
+// Fill in all but the SPIR-V usage from a pool.
+void GetPoolMemoryStats(const TPoolAllocator& pool, TMemoryStats& stats)
+{
+    stats.poolPages = ToMemoryUsage(pool.getPageUsage());
+    stats.ast = ToMemoryUsage(pool.getUsage(EPoolAst));
+    stats.symbolTable = ToMemoryUsage(pool.getUsage(EPoolSymbolTable));
+    stats.strings = ToMemoryUsage(pool.getUsage(EPoolString));
+}
+
+} // end anonymous namespace
+
 class TDeferredCompiler : public TCompiler {
 public:
     TDeferredCompiler(EShLanguage s, TInfoSink& i) : TCompiler(s, i) { }
@@ -1721,12 +2274,15 @@ public:
 };
 
 TShader::TShader(EShLanguage s)
-    : stage(s), lengths(nullptr), stringNames(nullptr), preamble("")
+    : stage(s), lengths(nullptr), stringNames(nullptr), preamble(""), preprocessCache(nullptr)
 {
     pool = new TPoolAllocator;
     infoSink = new TInfoSink;
     compiler = new TDeferredCompiler(stage, *infoSink);
     intermediate = new TIntermediate(s);
+    spirvMemory.current = 0;
+    spirvMemory.peak = 0;
+    intermediate->setSpirvMemoryRecord(&spirvMemory);
 
     // clear environment (avoid constructors in them for use in a C interface)
     environment.input.languageFamily = EShSourceNone;
@@ -1830,6 +2386,7 @@ void TShader::setUniformLocationBase(int base)
 void TShader::setNoStorageFormat(bool useUnknownFormat) { intermediate->setNoStorageFormat(useUnknownFormat); }
 void TShader::setResourceSetBinding(const std::vector<std::string>& base)   { intermediate->setResourceSetBinding(base); }
 void TShader::setTextureSamplerTransformMode(EShTextureSamplerTransformMode mode) { intermediate->setTextureSamplerTransformMode(mode); }
+void TShader::setIncludeCache(TIncludeCache* cache)     { intermediate->setIncludeCache(cache); }
 #endif
 
 #ifdef ENABLE_HLSL
@@ -1880,10 +2437,54 @@ bool TShader::preprocess(const TBuiltInResource* builtInResources,
     if (! preamble)
         preamble = "";
 
-    return PreprocessDeferred(compiler, strings, numStrings, lengths, stringNames, preamble,
-                              EShOptNone, builtInResources, defaultVersion,
-                              defaultProfile, forceDefaultVersionAndProfile,
-                              forwardCompatible, message, includer, *intermediate, output_string);
+    if (preprocessCache == nullptr)
+        return PreprocessDeferred(compiler, strings, numStrings, lengths, stringNames, preamble,
+                                  EShOptNone, builtInResources, defaultVersion,
+                                  defaultProfile, forceDefaultVersionAndProfile,
+                                  forwardCompatible, message, includer, *intermediate, output_string);
+
+    // Everything read, other than included files, goes into the key, along with
+    // all three parts of the version of glslang.
+    unsigned long long key = FnvBasis64;
+    key = HashPreprocessValue(key, GLSLANG_SPIRV_GENERATOR_VERSION);
+    key = HashPreprocessValue(key, GLSLANG_MINOR_VERSION);
+    key = HashPreprocessValue(key, GLSLANG_PATCH_LEVEL);
+    key = HashPreprocessValue(key, stage);
+    key = HashPreprocessValue(key, numStrings);
+    for (int s = 0; s < numStrings; ++s) {
+        size_t length = (lengths == nullptr || lengths[s] < 0) ? strlen(strings[s]) : lengths[s];
+        key = HashPreprocessString(key, strings[s], length);
+        const char* name = stringNames != nullptr ? stringNames[s] : nullptr;
+        key = HashPreprocessString(key, name, name != nullptr ? strlen(name) : 0);
+    }
+    key = HashPreprocessString(key, preamble, strlen(preamble));
+    key = HashFnv64(key, builtInResources, offsetof(TBuiltInResource, limits) + sizeof(TLimits));
+    key = HashPreprocessValue(key, defaultVersion);
+    key = HashPreprocessValue(key, defaultProfile);
+    key = HashPreprocessValue(key, forceDefaultVersionAndProfile);
+    key = HashPreprocessValue(key, forwardCompatible);
+    key = HashPreprocessValue(key, message);
+
+    PreprocessCache::Entry entry;
+    if (preprocessCache->find(key, entry) && IncludesUnchanged(entry.includes, includer)) {
+        *output_string = std::move(entry.output);
+        infoSink->info << entry.infoLog.c_str();
+        return entry.success;
+    }
+
+    entry.includes.clear();
+    TRecordingIncluder recordingIncluder(includer, entry.includes);
+    size_t logStart = strlen(infoSink->info.c_str());
+    entry.success = PreprocessDeferred(compiler, strings, numStrings, lengths, stringNames, preamble,
+                                       EShOptNone, builtInResources, defaultVersion,
+                                       defaultProfile, forceDefaultVersionAndProfile,
+                                       forwardCompatible, message, recordingIncluder, *intermediate,
+                                       output_string);
+    entry.output = *output_string;
+    entry.infoLog = std::string(infoSink->info.c_str() + logStart);
+    preprocessCache->store(key, entry);
+
+    return entry.success;
 }
 #endif
 
@@ -1897,6 +2498,18 @@ const char* TShader::getInfoDebugLog()
     return infoSink->debug.c_str();
 }
 
+void TShader::getMemoryStats(TMemoryStats& stats) const
+{
+    GetPoolMemoryStats(*pool, stats);
+    stats.spirv = spirvMemory;
+}
+
+void TShader::getResolutionStats(TResolutionStats& stats) const
+{
+    stats.builtInCalls = intermediate != nullptr ? intermediate->getBuiltInResolutions() : 0;
+    stats.reusedBuiltInCalls = intermediate != nullptr ? intermediate->getReusedBuiltInResolutions() : 0;
+}
+
 TProgram::TProgram() :
 #ifndef GLSLANG_WEB
     reflection(0),
@@ -1908,6 +2521,8 @@ TProgram::TProgram() :
     for (int s = 0; s < EShLangCount; ++s) {
         intermediate[s] = 0;
         newedIntermediate[s] = false;
+        spirvMemory[s].current = 0;
+        spirvMemory[s].peak = 0;
     }
 }
 
@@ -1998,6 +2613,7 @@ bool TProgram::linkStage(EShLanguage stage, EShMessages messages)
             intermediate[stage]->setOriginUpperLeft();
         }
         intermediate[stage]->setSpv(firstIntermediate->getSpv());
+        intermediate[stage]->setSpirvMemoryRecord(&spirvMemory[stage]);
 
         newedIntermediate[stage] = true;
     }
@@ -2031,6 +2647,53 @@ const char* TProgram::getInfoDebugLog()
     return infoSink->debug.c_str();
 }
 
+void TProgram::getMemoryStats(TMemoryStats& stats) const
+{
+    GetPoolMemoryStats(*pool, stats);
+    stats.spirv.current = 0;
+    stats.spirv.peak = 0;
+    for (int s = 0; s < EShLangCount; ++s) {
+        if (intermediate[s] != nullptr && intermediate[s]->getSpirvMemoryRecord() != nullptr) {
+            stats.spirv.current += intermediate[s]->getSpirvMemoryRecord()->current;
+            stats.spirv.peak += intermediate[s]->getSpirvMemoryRecord()->peak;
+        }
+    }
+}
+
+void TProgram::releaseIntermediates()
+{
+    TPoolAllocator* frontEndPool = pool;
+    pool = new TPoolAllocator;
+    SetThreadPoolAllocator(pool);
+
+#ifndef GLSLANG_WEB
+    // Reflection refers to types in the intermediates, or copies of them in the
+    // program's pool.
+    if (reflection != nullptr)
+        reflection->copyTypes();
+#endif
+
+    for (int s = 0; s < EShLangCount; ++s) {
+        if (newedIntermediate[s])
+            delete intermediate[s];
+        intermediate[s] = nullptr;
+        newedIntermediate[s] = false;
+
+        // Shaders stay usable, as if newly made for their stage.
+        for (TShader* shader : stages[s]) {
+            delete shader->intermediate;
+            shader->intermediate = new TIntermediate(shader->stage);
+            shader->spirvMemory.current = 0;
+            shader->spirvMemory.peak = 0;
+            shader->intermediate->setSpirvMemoryRecord(&shader->spirvMemory);
+            delete shader->pool;
+            shader->pool = new TPoolAllocator;
+        }
+    }
+
+    delete frontEndPool;
+}
+
 #ifndef GLSLANG_WEB
 
 //
@@ -43,9 +43,57 @@
 //
 
 #include "SymbolTable.h"
+#include "Hash.h"
+#ifndef GLSLANG_WEB
+#include "SymbolTableSnapshot.h"
+#endif
+
+#include <cstring>
 
 namespace glslang {
 
+namespace {
+
+// Slots index into the entries, with -1 for an empty slot.
+bool IsEmptyEntrySlot(int entry)
+{
+    return entry < 0;
+}
+
+// Find the index of the entry of the given name, through the slots of an
+// open-addressing table into 'entries', or return -1.
+template<class T>
+int FindEntry(const TVector<T>& entries, const TVector<int>& slots, unsigned int hash, const char* name,
+              size_t length)
+{
+    if (slots.empty())
+        return -1;
+
+    return slots[ProbeSlots(slots, hash, IsEmptyEntrySlot, [&](int e) {
+        const T& entry = entries[e];
+        return entry.hash == hash && entry.name.size() == length && entry.name.compare(0, length, name, length) == 0;
+    })];
+}
+
+// Add the last of 'entries' to the slots, growing them to stay at most half full.
+template<class T>
+void AddEntry(const TVector<T>& entries, TVector<int>& slots)
+{
+    size_t first = entries.size() - 1;
+    if (2 * entries.size() > slots.size()) {
+        size_t size = slots.empty() ? 16 : slots.size();
+        while (2 * entries.size() > size)
+            size *= 2;
+        slots.assign(size, -1);
+        first = 0;
+    }
+
+    for (size_t e = first; e < entries.size(); ++e)
+        slots[ProbeSlots(slots, entries[e].hash, IsEmptyEntrySlot, NoMatch())] = (int)e;
+}
+
+} // end anonymous namespace
+
 //
 // TType helper function needs a place to live.
 //
@@ -53,65 +101,80 @@ namespace glslang {
 //
 // Recursively generate mangled names.
 //
+// Most types mangle to a handful of characters, so these are gathered in
+// 'text', and appended to the name at once, rather than growing the name a
+// character at a time.  Only structures and long array suffixes flush early.
+//
 void TType::buildMangledName(TString& mangledName) const
 {
+    char text[64];
+    int length = 0;
+    const auto add = [&](const char* s) {
+        while (*s != '\0')
+            text[length++] = *s++;
+    };
+    const auto flush = [&]() {
+        mangledName.append(text, length);
+        length = 0;
+    };
+
     if (isMatrix())
-        mangledName += 'm';
+        add("m");
     else if (isVector())
-        mangledName += 'v';
+        add("v");
 
     switch (basicType) {
-    case EbtFloat:              mangledName += 'f';      break;
-    case EbtInt:                mangledName += 'i';      break;
-    case EbtUint:               mangledName += 'u';      break;
-    case EbtBool:               mangledName += 'b';      break;
+    case EbtFloat:              add("f");      break;
+    case EbtInt:                add("i");      break;
+    case EbtUint:               add("u");      break;
+    case EbtBool:               add("b");      break;
 #ifndef GLSLANG_WEB
-    case EbtDouble:             mangledName += 'd';      break;
-    case EbtFloat16:            mangledName += "f16";    break;
-    case EbtInt8:               mangledName += "i8";     break;
-    case EbtUint8:              mangledName += "u8";     break;
-    case EbtInt16:              mangledName += "i16";    break;
-    case EbtUint16:             mangledName += "u16";    break;
-    case EbtInt64:              mangledName += "i64";    break;
-    case EbtUint64:             mangledName += "u64";    break;
-    case EbtAtomicUint:         mangledName += "au";     break;
-    case EbtAccStruct:          mangledName += "as";     break;
-    case EbtRayQuery:           mangledName += "rq";     break;
+    case EbtDouble:             add("d");      break;
+    case EbtFloat16:            add("f16");    break;
+    case EbtInt8:               add("i8");     break;
+    case EbtUint8:              add("u8");     break;
+    case EbtInt16:              add("i16");    break;
+    case EbtUint16:             add("u16");    break;
+    case EbtInt64:              add("i64");    break;
+    case EbtUint64:             add("u64");    break;
+    case EbtAtomicUint:         add("au");     break;
+    case EbtAccStruct:          add("as");     break;
+    case EbtRayQuery:           add("rq");     break;
 #endif
     case EbtSampler:
         switch (sampler.type) {
 #ifndef GLSLANG_WEB
-        case EbtFloat16: mangledName += "f16"; break;
+        case EbtFloat16: add("f16"); break;
 #endif
-        case EbtInt:   mangledName += "i"; break;
-        case EbtUint:  mangledName += "u"; break;
+        case EbtInt:   add("i"); break;
+        case EbtUint:  add("u"); break;
         default: break; // some compilers want this
         }
         if (sampler.isImageClass())
-            mangledName += "I";  // a normal image or subpass
+            add("I");  // a normal image or subpass
         else if (sampler.isPureSampler())
-            mangledName += "p";  // a "pure" sampler
+            add("p");  // a "pure" sampler
         else if (!sampler.isCombined())
-            mangledName += "t";  // a "pure" texture
+            add("t");  // a "pure" texture
         else
-            mangledName += "s";  // traditional combined sampler
+            add("s");  // traditional combined sampler
         if (sampler.isArrayed())
-            mangledName += "A";
+            add("A");
         if (sampler.isShadow())
-            mangledName += "S";
+            add("S");
         if (sampler.isExternal())
-            mangledName += "E";
+            add("E");
         if (sampler.isYuv())
-            mangledName += "Y";
+            add("Y");
         switch (sampler.dim) {
-        case Esd2D:       mangledName += "2";  break;
-        case Esd3D:       mangledName += "3";  break;
-        case EsdCube:     mangledName += "C";  break;
+        case Esd2D:       add("2");  break;
+        case Esd3D:       add("3");  break;
+        case EsdCube:     add("C");  break;
 #ifndef GLSLANG_WEB
-        case Esd1D:       mangledName += "1";  break;
-        case EsdRect:     mangledName += "R2"; break;
-        case EsdBuffer:   mangledName += "B";  break;
-        case EsdSubpass:  mangledName += "P";  break;
+        case Esd1D:       add("1");  break;
+        case EsdRect:     add("R2"); break;
+        case EsdBuffer:   add("B");  break;
+        case EsdSubpass:  add("P");  break;
 #endif
         default: break; // some compilers want this
         }
@@ -119,30 +182,31 @@ void TType::buildMangledName(TString& mangledName) const
 #ifdef ENABLE_HLSL
         if (sampler.hasReturnStruct()) {
             // Name mangle for sampler return struct uses struct table index.
-            mangledName += "-tx-struct";
+            add("-tx-struct");
 
-            char text[16]; // plenty enough space for the small integers.
-            snprintf(text, sizeof(text), "%u-", sampler.getStructReturnIndex());
-            mangledName += text;
+            char index[16]; // plenty enough space for the small integers.
+            snprintf(index, sizeof(index), "%u-", sampler.getStructReturnIndex());
+            add(index);
         } else {
             switch (sampler.getVectorSize()) {
-            case 1: mangledName += "1"; break;
-            case 2: mangledName += "2"; break;
-            case 3: mangledName += "3"; break;
+            case 1: add("1"); break;
+            case 2: add("2"); break;
+            case 3: add("3"); break;
             case 4: break; // default to prior name mangle behavior
             }
         }
 #endif
 
         if (sampler.isMultiSample())
-            mangledName += "M";
+            add("M");
         break;
     case EbtStruct:
     case EbtBlock:
         if (basicType == EbtStruct)
-            mangledName += "struct-";
+            add("struct-");
         else
-            mangledName += "block-";
+            add("block-");
+        flush();
         if (typeName)
             mangledName += *typeName;
         for (unsigned int i = 0; i < structure->size(); ++i) {
@@ -154,10 +218,10 @@ void TType::buildMangledName(TString& mangledName) const
     }
 
     if (getVectorSize() > 0)
-        mangledName += static_cast<char>('0' + getVectorSize());
+        text[length++] = static_cast<char>('0' + getVectorSize());
     else {
-        mangledName += static_cast<char>('0' + getMatrixCols());
-        mangledName += static_cast<char>('0' + getMatrixRows());
+        text[length++] = static_cast<char>('0' + getMatrixCols());
+        text[length++] = static_cast<char>('0' + getMatrixRows());
     }
 
     if (arraySizes) {
@@ -171,11 +235,15 @@ void TType::buildMangledName(TString& mangledName) const
                     snprintf(buf, maxSize, "s%p", arraySizes->getDimNode(i));
             } else
                 snprintf(buf, maxSize, "%d", arraySizes->getDimSize(i));
-            mangledName += '[';
-            mangledName += buf;
-            mangledName += ']';
+            if (length + maxSize + 2 > (int)sizeof(text))
+                flush();
+            text[length++] = '[';
+            add(buf);
+            text[length++] = ']';
         }
     }
+
+    flush();
 }
 
 #ifndef GLSLANG_WEB
@@ -245,9 +313,26 @@ void TAnonMember::dump(TInfoSink& TInfoSink, bool) const
 
 void TSymbolTableLevel::dump(TInfoSink& infoSink, bool complete) const
 {
-    tLevel::const_iterator it;
-    for (it = level.begin(); it != level.end(); ++it)
-        (*it).second->dump(infoSink, complete);
+    if (lazyFunctions == nullptr) {
+        TVector<const TLevelSymbol*> sorted;
+        getSortedSymbols(sorted);
+        for (auto it = sorted.begin(); it != sorted.end(); ++it)
+            (*it)->symbol->dump(infoSink, complete);
+
+        return;
+    }
+
+    // Make all the lazy functions, and dump them in order along with everything else.
+    std::map<TString, const TSymbol*> all;
+    for (auto it = symbols.begin(); it != symbols.end(); ++it)
+        all[it->name] = it->symbol;
+    for (auto group = lazyFunctions->begin(); group != lazyFunctions->end(); ++group) {
+        const TVector<TFunction*>& functions = group->second->getFunctions();
+        for (auto function = functions.begin(); function != functions.end(); ++function)
+            all[(*function)->getMangledName()] = *function;
+    }
+    for (auto it = all.begin(); it != all.end(); ++it)
+        it->second->dump(infoSink, complete);
 }
 
 void TSymbolTable::dump(TInfoSink& infoSink, bool complete) const
@@ -274,46 +359,75 @@ TFunction::~TFunction()
 //
 TSymbolTableLevel::~TSymbolTableLevel()
 {
-    for (tLevel::iterator it = level.begin(); it != level.end(); ++it)
-        delete (*it).second;
+    for (auto it = symbols.begin(); it != symbols.end(); ++it)
+        delete it->symbol;
 
     delete [] defaultPrecision;
 }
 
+//
+// Lookups of built-in functions that were loaded lazily from a snapshot;
+// the first lookup of a name makes all the functions of that name.
+//
+TSymbol* TSymbolTableLevel::findLazyFunction(const TString& mangledName) const
+{
+#ifndef GLSLANG_WEB
+    TString::size_type parenAt = mangledName.find_first_of('(');
+    if (parenAt == mangledName.npos)
+        return nullptr;
+
+    tLazyFunctions::const_iterator group = lazyFunctions->find(TString(mangledName, 0, parenAt));
+    if (group == lazyFunctions->end())
+        return nullptr;
+
+    const TVector<TFunction*>& functions = group->second->getFunctions();
+    for (auto function = functions.begin(); function != functions.end(); ++function) {
+        if ((*function)->getMangledName() == mangledName)
+            return *function;
+    }
+#endif
+
+    return nullptr;
+}
+
+void TSymbolTableLevel::findLazyFunctionNameList(const TString& baseName, TVector<const TFunction*>& list) const
+{
+#ifndef GLSLANG_WEB
+    tLazyFunctions::const_iterator group = lazyFunctions->find(baseName);
+    if (group == lazyFunctions->end())
+        return;
+
+    const TVector<TFunction*>& functions = group->second->getFunctions();
+    list.insert(list.end(), functions.begin(), functions.end());
+#endif
+}
+
 //
 // Change all function entries in the table with the non-mangled name
 // to be related to the provided built-in operation.
 //
 void TSymbolTableLevel::relateToOperator(const char* name, TOperator op)
 {
-    tLevel::const_iterator candidate = level.lower_bound(name);
-    while (candidate != level.end()) {
-        const TString& candidateName = (*candidate).first;
-        TString::size_type parenAt = candidateName.find_first_of('(');
-        if (parenAt != candidateName.npos && candidateName.compare(0, parenAt, name) == 0) {
-            TFunction* function = (*candidate).second->getAsFunction();
-            function->relateToOperator(op);
-        } else
-            break;
-        ++candidate;
-    }
+    int set = findOverloadSet(name, strlen(name));
+    if (set < 0)
+        return;
+
+    const TVector<TFunction*>& functions = overloadSets[set].functions;
+    for (auto function = functions.begin(); function != functions.end(); ++function)
+        (*function)->relateToOperator(op);
 }
 
 // Make all function overloads of the given name require an extension(s).
 // Should only be used for a version/profile that actually needs the extension(s).
-void TSymbolTableLevel::setFunctionExtensions(const char* name, int num, const char* const extensions[])
+void TSymbolTableLevel::setFunctionExtensions(const char* name, int num, const TExtension extensions[])
 {
-    tLevel::const_iterator candidate = level.lower_bound(name);
-    while (candidate != level.end()) {
-        const TString& candidateName = (*candidate).first;
-        TString::size_type parenAt = candidateName.find_first_of('(');
-        if (parenAt != candidateName.npos && candidateName.compare(0, parenAt, name) == 0) {
-            TSymbol* symbol = candidate->second;
-            symbol->setExtensions(num, extensions);
-        } else
-            break;
-        ++candidate;
-    }
+    int set = findOverloadSet(name, strlen(name));
+    if (set < 0)
+        return;
+
+    const TVector<TFunction*>& functions = overloadSets[set].functions;
+    for (auto function = functions.begin(); function != functions.end(); ++function)
+        (*function)->setExtensions(num, extensions);
 }
 
 //
@@ -321,8 +435,67 @@ void TSymbolTableLevel::setFunctionExtensions(const char* name, int num, const c
 //
 void TSymbolTableLevel::readOnly()
 {
-    for (tLevel::iterator it = level.begin(); it != level.end(); ++it)
-        (*it).second->makeReadOnly();
+    for (auto it = symbols.begin(); it != symbols.end(); ++it)
+        it->symbol->makeReadOnly();
+}
+
+//
+// Hashed lookups of the symbols and overload sets of a level.
+//
+
+int TSymbolTableLevel::findSymbol(const char* name, size_t length) const
+{
+    return FindEntry(symbols, symbolSlots, HashFnv(FnvBasis, name, length), name, length);
+}
+
+int TSymbolTableLevel::findOverloadSet(const char* name, size_t length) const
+{
+    return FindEntry(overloadSets, overloadSetSlots, HashFnv(FnvBasis, name, length), name, length);
+}
+
+// Add a symbol under the given name, unless the name is already taken.
+bool TSymbolTableLevel::addSymbol(const TString& name, TSymbol& symbol)
+{
+    unsigned int hash = HashFnv(FnvBasis, name.c_str(), name.size());
+    if (FindEntry(symbols, symbolSlots, hash, name.c_str(), name.size()) >= 0)
+        return false;
+
+    TLevelSymbol entry = { name, hash, &symbol };
+    symbols.push_back(entry);
+    AddEntry(symbols, symbolSlots);
+
+    return true;
+}
+
+// Add a function, already added under its mangled name, to the overload set of its base name.
+void TSymbolTableLevel::addOverload(const TString& mangledName, TFunction& function)
+{
+    size_t parenAt = mangledName.find_first_of('(');
+    unsigned int hash = HashFnv(FnvBasis, mangledName.c_str(), parenAt);
+    int set = FindEntry(overloadSets, overloadSetSlots, hash, mangledName.c_str(), parenAt);
+    if (set < 0) {
+        TOverloadSet entry = { TString(mangledName, 0, parenAt), hash, TVector<TFunction*>() };
+        overloadSets.push_back(entry);
+        AddEntry(overloadSets, overloadSetSlots);
+        set = (int)overloadSets.size() - 1;
+    }
+
+    // keep the order the names of an ordered map would give, for overload resolution to see
+    TVector<TFunction*>& functions = overloadSets[set].functions;
+    auto position = std::lower_bound(functions.begin(), functions.end(), &mangledName,
+                                     [](const TFunction* a, const TString* b) { return a->getMangledName() < *b; });
+    functions.insert(position, &function);
+}
+
+// The symbols of the level in the order of their names, for output and copies
+// to not depend on the order of insertion.
+void TSymbolTableLevel::getSortedSymbols(TVector<const TLevelSymbol*>& sorted) const
+{
+    sorted.reserve(symbols.size());
+    for (auto it = symbols.begin(); it != symbols.end(); ++it)
+        sorted.push_back(&*it);
+    std::sort(sorted.begin(), sorted.end(),
+              [](const TLevelSymbol* a, const TLevelSymbol* b) { return a->name < b->name; });
 }
 
 //
@@ -410,10 +583,13 @@ TSymbolTableLevel* TSymbolTableLevel::clone() const
     TSymbolTableLevel *symTableLevel = new TSymbolTableLevel();
     symTableLevel->anonId = anonId;
     symTableLevel->thisLevel = thisLevel;
+    // the lazy functions are shared, not copied, as they are never modified once made
+    symTableLevel->lazyFunctions = lazyFunctions;
     std::vector<bool> containerCopied(anonId, false);
-    tLevel::const_iterator iter;
-    for (iter = level.begin(); iter != level.end(); ++iter) {
-        const TAnonMember* anon = iter->second->getAsAnonMember();
+    TVector<const TLevelSymbol*> sorted;
+    getSortedSymbols(sorted);
+    for (auto iter = sorted.begin(); iter != sorted.end(); ++iter) {
+        const TAnonMember* anon = (*iter)->symbol->getAsAnonMember();
         if (anon) {
             // Insert all the anonymous members of this same container at once,
             // avoid inserting the remaining members in the future, once this has been done,
@@ -426,7 +602,7 @@ TSymbolTableLevel* TSymbolTableLevel::clone() const
                 containerCopied[anon->getAnonId()] = true;
             }
         } else
-            symTableLevel->insert(*iter->second->clone(), false);
+            symTableLevel->insert(*(*iter)->symbol->clone(), false);
     }
 
     return symTableLevel;
@@ -436,6 +612,7 @@ void TSymbolTable::copyTable(const TSymbolTable& copyOf)
 {
     assert(adoptedLevels == copyOf.adoptedLevels);
 
+    TPoolCategoryScope category(EPoolSymbolTable);
     uniqueId = copyOf.uniqueId;
     noBuiltInRedeclarations = copyOf.noBuiltInRedeclarations;
     separateNameSpaces = copyOf.separateNameSpaces;
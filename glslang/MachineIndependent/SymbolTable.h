@@ -68,6 +68,7 @@
 #include "../Include/Common.h"
 #include "../Include/intermediate.h"
 #include "../Include/InfoSink.h"
+#include "Versions.h"
 
 namespace glslang {
 
@@ -78,8 +79,9 @@ namespace glslang {
 class TVariable;
 class TFunction;
 class TAnonMember;
+class TLazyFunctionGroup;
 
-typedef TVector<const char*> TExtensionList;
+typedef TVector<TExtension> TExtensionList;
 
 class TSymbol {
 public:
@@ -106,7 +108,7 @@ public:
     virtual TType& getWritableType() = 0;
     virtual void setUniqueId(int id) { uniqueId = id; }
     virtual int getUniqueId() const { return uniqueId; }
-    virtual void setExtensions(int numExts, const char* const exts[])
+    virtual void setExtensions(int numExts, const TExtension exts[])
     {
         assert(extensions == 0);
         assert(numExts > 0);
@@ -115,7 +117,7 @@ public:
             extensions->push_back(exts[e]);
     }
     virtual int getNumExtensions() const { return extensions == nullptr ? 0 : (int)extensions->size(); }
-    virtual const char** getExtensions() const { return extensions->data(); }
+    virtual const TExtension* getExtensions() const { return extensions->data(); }
 
 #ifndef GLSLANG_WEB
     virtual void dump(TInfoSink& infoSink, bool complete = false) const = 0;
@@ -134,7 +136,7 @@ protected:
 
     // For tracking what extensions must be present
     // (don't use if correct version/profile is present).
-    TExtensionList* extensions; // an array of pointers to existing constant char strings
+    TExtensionList* extensions; // the known extensions, by name and id
 
     //
     // N.B.: Non-const functions that will be generally used should assert on this,
@@ -178,7 +180,7 @@ public:
     virtual void setAnonId(int i) { anonId = i; }
     virtual int getAnonId() const { return anonId; }
 
-    virtual void setMemberExtensions(int member, int numExts, const char* const exts[])
+    virtual void setMemberExtensions(int member, int numExts, const TExtension exts[])
     {
         assert(type.isStruct());
         assert(numExts > 0);
@@ -194,13 +196,16 @@ public:
     {
         return memberExtensions == nullptr ? 0 : (int)(*memberExtensions)[member].size();
     }
-    virtual const char** getMemberExtensions(int member) const { return (*memberExtensions)[member].data(); }
+    virtual const TExtension* getMemberExtensions(int member) const { return (*memberExtensions)[member].data(); }
 
 #ifndef GLSLANG_WEB
     virtual void dump(TInfoSink& infoSink, bool complete = false) const;
 #endif
 
 protected:
+    friend class TSymbolTableSnapshotWriter;
+    friend class TSymbolTableSnapshotReader;
+
     explicit TVariable(const TVariable&);
     TVariable& operator=(const TVariable&);
 
@@ -324,6 +329,9 @@ public:
 #endif
 
 protected:
+    friend class TSymbolTableSnapshotWriter;
+    friend class TSymbolTableSnapshotReader;
+
     explicit TFunction(const TFunction&);
     TFunction& operator=(const TFunction&);
 
@@ -373,12 +381,12 @@ public:
         return *types[memberNumber].type;
     }
 
-    virtual void setExtensions(int numExts, const char* const exts[]) override
+    virtual void setExtensions(int numExts, const TExtension exts[]) override
     {
         anonContainer.setMemberExtensions(memberNumber, numExts, exts);
     }
     virtual int getNumExtensions() const override { return anonContainer.getNumMemberExtensions(memberNumber); }
-    virtual const char** getExtensions() const override { return anonContainer.getMemberExtensions(memberNumber); }
+    virtual const TExtension* getExtensions() const override { return anonContainer.getMemberExtensions(memberNumber); }
 
     virtual int getAnonId() const { return anonId; }
 #ifndef GLSLANG_WEB
@@ -397,7 +405,7 @@ protected:
 class TSymbolTableLevel {
 public:
     POOL_ALLOCATOR_NEW_DELETE(GetThreadPoolAllocator())
-    TSymbolTableLevel() : defaultPrecision(0), anonId(0), thisLevel(false) { }
+    TSymbolTableLevel() : defaultPrecision(0), anonId(0), thisLevel(false), lazyFunctions(nullptr) { }
     ~TSymbolTableLevel();
 
     bool insert(TSymbol& symbol, bool separateNameSpaces)
@@ -422,15 +430,16 @@ public:
             const TString& insertName = symbol.getMangledName();
             if (symbol.getAsFunction()) {
                 // make sure there isn't a variable of this name
-                if (! separateNameSpaces && level.find(name) != level.end())
+                if (! separateNameSpaces && findSymbol(name.c_str(), name.size()) >= 0)
                     return false;
 
                 // insert, and whatever happens is okay
-                level.insert(tLevelPair(insertName, &symbol));
+                if (addSymbol(insertName, symbol))
+                    addOverload(insertName, *symbol.getAsFunction());
 
                 return true;
             } else
-                return level.insert(tLevelPair(insertName, &symbol)).second;
+                return addSymbol(insertName, symbol);
         }
     }
 
@@ -451,7 +460,7 @@ public:
         const TTypeList& types = *symbol.getAsVariable()->getType().getStruct();
         for (unsigned int m = firstMember; m < types.size(); ++m) {
             TAnonMember* member = new TAnonMember(&types[m].type->getFieldName(), m, *symbol.getAsVariable(), symbol.getAsVariable()->getAnonId());
-            if (! level.insert(tLevelPair(member->getMangledName(), member)).second)
+            if (! addSymbol(member->getMangledName(), *member))
                 return false;
         }
 
@@ -460,63 +469,48 @@ public:
 
     TSymbol* find(const TString& name) const
     {
-        tLevel::const_iterator it = level.find(name);
-        if (it == level.end())
-            return 0;
+        int entry = findSymbol(name.c_str(), name.size());
+        if (entry < 0)
+            return lazyFunctions != nullptr ? findLazyFunction(name) : 0;
         else
-            return (*it).second;
+            return symbols[entry].symbol;
     }
 
     void findFunctionNameList(const TString& name, TVector<const TFunction*>& list)
     {
         size_t parenAt = name.find_first_of('(');
-        TString base(name, 0, parenAt + 1);
 
-        tLevel::const_iterator begin = level.lower_bound(base);
-        base[parenAt] = ')';  // assume ')' is lexically after '('
-        tLevel::const_iterator end = level.upper_bound(base);
-        for (tLevel::const_iterator it = begin; it != end; ++it)
-            list.push_back(it->second->getAsFunction());
+        int set = findOverloadSet(name.c_str(), parenAt);
+        if (set >= 0)
+            list.insert(list.end(), overloadSets[set].functions.begin(), overloadSets[set].functions.end());
+
+        if (lazyFunctions != nullptr)
+            findLazyFunctionNameList(TString(name, 0, parenAt), list);
     }
 
     // See if there is already a function in the table having the given non-function-style name.
     bool hasFunctionName(const TString& name) const
     {
-        tLevel::const_iterator candidate = level.lower_bound(name);
-        if (candidate != level.end()) {
-            const TString& candidateName = (*candidate).first;
-            TString::size_type parenAt = candidateName.find_first_of('(');
-            if (parenAt != candidateName.npos && candidateName.compare(0, parenAt, name) == 0)
-
-                return true;
-        }
+        if (lazyFunctions != nullptr && lazyFunctions->find(name) != lazyFunctions->end())
+            return true;
 
-        return false;
+        return findOverloadSet(name.c_str(), name.size()) >= 0;
     }
 
     // See if there is a variable at this level having the given non-function-style name.
     // Return true if name is found, and set variable to true if the name was a variable.
     bool findFunctionVariableName(const TString& name, bool& variable) const
     {
-        tLevel::const_iterator candidate = level.lower_bound(name);
-        if (candidate != level.end()) {
-            const TString& candidateName = (*candidate).first;
-            TString::size_type parenAt = candidateName.find_first_of('(');
-            if (parenAt == candidateName.npos) {
-                // not a mangled name
-                if (candidateName == name) {
-                    // found a variable name match
-                    variable = true;
-                    return true;
-                }
-            } else {
-                // a mangled name
-                if (candidateName.compare(0, parenAt, name) == 0) {
-                    // found a function name match
-                    variable = false;
-                    return true;
-                }
-            }
+        // functions are held by their mangled names, so only a variable has just the name
+        if (findSymbol(name.c_str(), name.size()) >= 0) {
+            variable = true;
+            return true;
+        }
+
+        if (findOverloadSet(name.c_str(), name.size()) >= 0 ||
+            (lazyFunctions != nullptr && lazyFunctions->find(name) != lazyFunctions->end())) {
+            variable = false;
+            return true;
         }
 
         return false;
@@ -550,7 +544,7 @@ public:
     }
 
     void relateToOperator(const char* name, TOperator op);
-    void setFunctionExtensions(const char* name, int num, const char* const extensions[]);
+    void setFunctionExtensions(const char* name, int num, const TExtension extensions[]);
 #ifndef GLSLANG_WEB
     void dump(TInfoSink& infoSink, bool complete = false) const;
 #endif
@@ -561,18 +555,49 @@ public:
     bool isThisLevel() const { return thisLevel; }
 
 protected:
+    friend class TSymbolTableSnapshotWriter;
+    friend class TSymbolTableSnapshotReader;
+
     explicit TSymbolTableLevel(TSymbolTableLevel&);
     TSymbolTableLevel& operator=(TSymbolTableLevel&);
 
-    typedef std::map<TString, TSymbol*, std::less<TString>, pool_allocator<std::pair<const TString, TSymbol*> > > tLevel;
-    typedef const tLevel::value_type tLevelPair;
-    typedef std::pair<tLevel::iterator, bool> tInsertResult;
-
-    tLevel level;  // named mappings
+    TSymbol* findLazyFunction(const TString& mangledName) const;
+    void findLazyFunctionNameList(const TString& baseName, TVector<const TFunction*>& list) const;
+
+    // The symbols are kept in the order they were inserted, and found through
+    // open-addressing hash tables of indexes into them, -1 marking an empty slot.
+    // Functions are held by their mangled names, and also gathered in an
+    // overload set per base name, so finding all the overloads of a name is a
+    // single lookup, rather than a scan of the names sharing its prefix.
+    struct TLevelSymbol {
+        TString name;
+        unsigned int hash;
+        TSymbol* symbol;
+    };
+    struct TOverloadSet {
+        TString name;                 // the base name of the functions
+        unsigned int hash;
+        TVector<TFunction*> functions;  // in the order of their mangled names
+    };
+
+    int findSymbol(const char* name, size_t length) const;
+    int findOverloadSet(const char* name, size_t length) const;
+    bool addSymbol(const TString& name, TSymbol&);
+    void addOverload(const TString& mangledName, TFunction&);
+    void getSortedSymbols(TVector<const TLevelSymbol*>&) const;
+
+    typedef std::map<TString, TLazyFunctionGroup*, std::less<TString>,
+                     pool_allocator<std::pair<const TString, TLazyFunctionGroup*> > > tLazyFunctions;
+
+    TVector<TLevelSymbol> symbols;
+    TVector<int> symbolSlots;
+    TVector<TOverloadSet> overloadSets;
+    TVector<int> overloadSetSlots;
     TPrecisionQualifier *defaultPrecision;
     int anonId;
     bool thisLevel;  // True if this level of the symbol table is a structure scope containing member function
                      // that are supposed to see anonymous access to member variables.
+    tLazyFunctions* lazyFunctions;  // built-in functions loaded from a snapshot, made on first lookup; nullptr if none
 };
 
 class TSymbolTable {
@@ -626,6 +651,7 @@ public:
 
     void push()
     {
+        TPoolCategoryScope category(EPoolSymbolTable);
         table.push_back(new TSymbolTableLevel);
     }
 
@@ -638,6 +664,7 @@ public:
     void pushThis(TSymbol& thisSymbol)
     {
         assert(thisSymbol.getName().size() == 0);
+        TPoolCategoryScope category(EPoolSymbolTable);
         table.push_back(new TSymbolTableLevel);
         table.back()->setThisLevel();
         insert(thisSymbol);
@@ -658,6 +685,7 @@ public:
     //
     bool insert(TSymbol& symbol)
     {
+        TPoolCategoryScope category(EPoolSymbolTable);
         symbol.setUniqueId(++uniqueId);
 
         // make sure there isn't a function of this variable name
@@ -682,6 +710,7 @@ public:
     {
         // See insert() for comments on basic explanation of insert.
         // This operates similarly, but more simply.
+        TPoolCategoryScope category(EPoolSymbolTable);
         return table[currentLevel()]->amend(symbol, firstNewMember);
     }
 
@@ -703,6 +732,7 @@ public:
     //
     TSymbol* copyUpDeferredInsert(TSymbol* shared)
     {
+        TPoolCategoryScope category(EPoolSymbolTable);
         if (shared->getAsVariable()) {
             TSymbol* copy = shared->clone();
             copy->setUniqueId(shared->getUniqueId());
@@ -720,6 +750,7 @@ public:
     TSymbol* copyUp(TSymbol* shared)
     {
         TSymbol* copy = copyUpDeferredInsert(shared);
+        TPoolCategoryScope category(EPoolSymbolTable);
         table[globalLevel]->insert(*copy, separateNameSpaces);
         if (shared->getAsVariable())
             return copy;
@@ -794,6 +825,18 @@ public:
         return false;
     }
 
+    // See if a user level has a function of the given non-function-style name,
+    // which would hide the built-in functions of that name.
+    bool hasUserFunctionName(const TString& name) const
+    {
+        for (int level = currentLevel(); level >= globalLevel; --level) {
+            if (table[level]->hasFunctionName(name))
+                return true;
+        }
+
+        return false;
+    }
+
     void findFunctionNameList(const TString& name, TVector<const TFunction*>& list, bool& builtIn)
     {
         // For user levels, return the set found in the first scope with a match
@@ -821,13 +864,13 @@ public:
             table[level]->relateToOperator(name, op);
     }
 
-    void setFunctionExtensions(const char* name, int num, const char* const extensions[])
+    void setFunctionExtensions(const char* name, int num, const TExtension extensions[])
     {
         for (unsigned int level = 0; level < table.size(); ++level)
             table[level]->setFunctionExtensions(name, num, extensions);
     }
 
-    void setVariableExtensions(const char* name, int numExts, const char* const extensions[])
+    void setVariableExtensions(const char* name, int numExts, const TExtension extensions[])
     {
         TSymbol* symbol = find(TString(name));
         if (symbol == nullptr)
@@ -836,7 +879,7 @@ public:
         symbol->setExtensions(numExts, extensions);
     }
 
-    void setVariableExtensions(const char* blockName, const char* name, int numExts, const char* const extensions[])
+    void setVariableExtensions(const char* blockName, const char* name, int numExts, const TExtension extensions[])
     {
         TSymbol* symbol = find(TString(blockName));
         if (symbol == nullptr)
@@ -868,6 +911,9 @@ public:
     }
 
 protected:
+    friend class TSymbolTableSnapshotWriter;
+    friend class TSymbolTableSnapshotReader;
+
     TSymbolTable(TSymbolTable&);
     TSymbolTable& operator=(TSymbolTableLevel&);
 
@@ -0,0 +1,1019 @@
+//
+// Copyright (C) 2020 The Khronos Group Inc.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//    Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+//    Redistributions in binary form must reproduce the above
+//    copyright notice, this list of conditions and the following
+//    disclaimer in the documentation and/or other materials provided
+//    with the distribution.
+//
+//    Neither the name of 3Dlabs Inc. Ltd. nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef GLSLANG_WEB
+
+//
+// Write and read binary snapshots of symbol tables; see SymbolTableSnapshot.h.
+//
+
+#include "SymbolTableSnapshot.h"
+#include "Hash.h"
+#include "../Include/revision.h"
+#include "../OSDependent/osinclude.h"
+
+#include <type_traits>
+
+// Hash of the source text that declares the built-ins, provided by the build
+// (see glslang/CMakeLists.txt), so snapshots saved before an edit to those
+// declarations are not loaded after it.  Builds that don't provide it only
+// have the patch level to tell such snapshots apart.
+#ifndef GLSLANG_BUILTIN_TEXT_HASH
+#define GLSLANG_BUILTIN_TEXT_HASH 0
+#endif
+
+namespace glslang {
+
+namespace {
+
+const unsigned int SnapshotMagic = 0x42534c47;  // "GLSB"
+const unsigned int SnapshotFormatVersion = 2;
+
+// Kinds of symbols recorded within a level.
+enum TSnapshotSymbol {
+    ESnapshotVariable,
+    ESnapshotFunctionGroup,  // all the functions of one base name
+    ESnapshotAnonContainer,  // container of anonymous members; reinserting it recreates the members
+};
+
+// Ways a structure can be recorded within a type.
+enum TSnapshotStructure {
+    ESnapshotNoStructure,
+    ESnapshotNewStructure,
+    ESnapshotSharedStructure,
+};
+
+static_assert(std::is_trivially_copyable<TQualifier>::value, "TQualifier is written as raw bytes");
+static_assert(std::is_trivially_copyable<TSampler>::value, "TSampler is written as raw bytes");
+
+
+// Anything that changes the meaning of the bytes written must change this.
+unsigned int BuildFingerprint()
+{
+    const unsigned int layout[] = {
+        SnapshotFormatVersion,
+        GLSLANG_PATCH_LEVEL,
+        (unsigned int)GLSLANG_BUILTIN_TEXT_HASH,
+        (unsigned int)sizeof(TQualifier),
+        (unsigned int)sizeof(TSampler),
+        (unsigned int)EbtNumTypes,
+        (unsigned int)EvqLast,
+        (unsigned int)EbvLast,
+        (unsigned int)EOpReadClockDeviceKHR,
+#ifdef ENABLE_HLSL
+        1,
+#else
+        0,
+#endif
+    };
+
+    return HashFnv(FnvBasis, layout, sizeof(layout));
+}
+
+struct TSnapshotHeader {
+    unsigned int magic;
+    unsigned int formatVersion;
+    unsigned int fingerprint;
+    unsigned int checksum;
+    unsigned long long payloadSize;
+};
+
+} // end anonymous namespace
+
+//
+// Writer
+//
+
+TSymbolTableSnapshotWriter::TSymbolTableSnapshotWriter(std::vector<unsigned char>& out) : out(out), ok(true)
+{
+    out.clear();
+    out.resize(sizeof(TSnapshotHeader));
+}
+
+bool TSymbolTableSnapshotWriter::finish()
+{
+    TSnapshotHeader header;
+    header.magic = SnapshotMagic;
+    header.formatVersion = SnapshotFormatVersion;
+    header.fingerprint = BuildFingerprint();
+    header.payloadSize = out.size() - sizeof(TSnapshotHeader);
+    header.checksum = HashFnv(FnvBasis, out.data() + sizeof(TSnapshotHeader), (size_t)header.payloadSize);
+    memcpy(out.data(), &header, sizeof(header));
+
+    return ok;
+}
+
+void TSymbolTableSnapshotWriter::writeBytes(const void* data, size_t size)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    out.insert(out.end(), bytes, bytes + size);
+}
+
+void TSymbolTableSnapshotWriter::writeString(const char* s)
+{
+    if (s == nullptr) {
+        write<int>(-1);
+        return;
+    }
+
+    int length = (int)strlen(s);
+    write(length);
+    writeBytes(s, length);
+}
+
+void TSymbolTableSnapshotWriter::writeString(const TString* s)
+{
+    if (s == nullptr) {
+        write<int>(-1);
+        return;
+    }
+
+    write((int)s->size());
+    writeBytes(s->data(), s->size());
+}
+
+void TSymbolTableSnapshotWriter::writeExtensions(int numExtensions, const TExtension* extensions)
+{
+    write(numExtensions);
+    for (int e = 0; e < numExtensions; ++e)
+        writeString(extensions[e].name);
+}
+
+void TSymbolTableSnapshotWriter::writeArraySizes(const TArraySizes* arraySizes)
+{
+    write<bool>(arraySizes != nullptr);
+    if (arraySizes == nullptr)
+        return;
+
+    write(arraySizes->getNumDims());
+    for (int d = 0; d < arraySizes->getNumDims(); ++d) {
+        // specialization-constant sizes refer into an AST, which is not recorded
+        if (arraySizes->getDimNode(d) != nullptr)
+            ok = false;
+        write(arraySizes->getDimSize(d));
+    }
+    write(arraySizes->getImplicitSize());
+    write(arraySizes->isVariablyIndexed());
+}
+
+void TSymbolTableSnapshotWriter::writeStructure(const TTypeList* structure)
+{
+    if (structure == nullptr) {
+        write<unsigned char>(ESnapshotNoStructure);
+        return;
+    }
+
+    auto previous = structures.find(structure);
+    if (previous != structures.end()) {
+        write<unsigned char>(ESnapshotSharedStructure);
+        write(previous->second);
+        return;
+    }
+
+    int index = (int)structures.size();
+    structures[structure] = index;
+    write<unsigned char>(ESnapshotNewStructure);
+    write((int)structure->size());
+    for (const TTypeLoc& member : *structure) {
+        write(member.loc.string);
+        write(member.loc.line);
+        write(member.loc.column);
+        writeType(*member.type);
+    }
+}
+
+void TSymbolTableSnapshotWriter::writeType(const TType& type)
+{
+    write<unsigned char>(type.basicType);
+    write<signed char>(type.vectorSize);
+    write<signed char>(type.matrixCols);
+    write<signed char>(type.matrixRows);
+    write<bool>(type.vector1);
+    write<bool>(type.coopmat);
+
+    TQualifier qualifier = type.qualifier;
+    qualifier.semanticName = nullptr;
+    writeBytes(&qualifier, sizeof(qualifier));
+    writeString(type.qualifier.semanticName);
+    writeBytes(&type.sampler, sizeof(type.sampler));
+
+    writeArraySizes(type.arraySizes);
+    writeArraySizes(type.typeParameters);
+
+    // references point at arbitrary user types, never part of a built-in table
+    if (type.basicType == EbtReference)
+        ok = false;
+    else
+        writeStructure(type.isStruct() ? type.structure : nullptr);
+
+    writeString(type.fieldName);
+    writeString(type.typeName);
+}
+
+void TSymbolTableSnapshotWriter::writeConstArray(const TConstUnionArray& constArray)
+{
+    write(constArray.size());
+    for (int c = 0; c < constArray.size(); ++c) {
+        const TConstUnion& value = constArray[c];
+        write<unsigned char>(value.getType());
+        switch (value.getType()) {
+        case EbtInt8:   write<long long>(value.getI8Const());  break;
+        case EbtInt16:  write<long long>(value.getI16Const()); break;
+        case EbtInt:    write<long long>(value.getIConst());   break;
+        case EbtInt64:  write<long long>(value.getI64Const()); break;
+        case EbtUint8:  write<unsigned long long>(value.getU8Const());  break;
+        case EbtUint16: write<unsigned long long>(value.getU16Const()); break;
+        case EbtUint:   write<unsigned long long>(value.getUConst());   break;
+        case EbtUint64: write<unsigned long long>(value.getU64Const()); break;
+        case EbtDouble: write<double>(value.getDConst()); break;
+        case EbtBool:   write<bool>(value.getBConst());   break;
+        default:
+            ok = false;
+            break;
+        }
+    }
+}
+
+void TSymbolTableSnapshotWriter::writeVariable(const TVariable& variable)
+{
+    writeString(&variable.getName());
+    write(variable.getUniqueId());
+    writeType(variable.type);
+    write(variable.userType);
+    writeExtensions(variable.getNumExtensions(), variable.getNumExtensions() > 0 ? variable.getExtensions() : nullptr);
+
+    write(variable.hasMemberExtensions());
+    if (variable.hasMemberExtensions()) {
+        for (int m = 0; m < (int)variable.type.getStruct()->size(); ++m) {
+            int numExtensions = variable.getNumMemberExtensions(m);
+            writeExtensions(numExtensions, numExtensions > 0 ? variable.getMemberExtensions(m) : nullptr);
+        }
+    }
+
+    writeConstArray(variable.constArray);
+}
+
+void TSymbolTableSnapshotWriter::writeFunction(const TFunction& function)
+{
+    writeString(&function.getName());
+    writeString(&function.mangledName);
+    write(function.getUniqueId());
+    writeType(function.returnType);
+    write(function.declaredBuiltIn);
+    write(function.op);
+    write(function.defined);
+    write(function.prototyped);
+    write(function.implicitThis);
+    write(function.illegalImplicitThis);
+    writeExtensions(function.getNumExtensions(), function.getNumExtensions() > 0 ? function.getExtensions() : nullptr);
+
+    write(function.getParamCount());
+    for (int p = 0; p < function.getParamCount(); ++p) {
+        const TParameter& param = function[p];
+        // default arguments are AST, which is not recorded
+        if (param.defaultValue != nullptr)
+            ok = false;
+        writeString(param.name);
+        writeType(*param.type);
+    }
+}
+
+void TSymbolTableSnapshotWriter::writeFunctionGroup(const TString& baseName, const TVector<const TFunction*>& functions)
+{
+    // Groups are decoded independently, so they can't share structures with anything else.
+    structures.clear();
+
+    writeString(&baseName);
+    write((int)functions.size());
+
+    // patched below, to let readers skip the group
+    size_t sizeOffset = out.size();
+    write<unsigned long long>(0);
+
+    for (const TFunction* function : functions)
+        writeFunction(*function);
+
+    unsigned long long size = out.size() - sizeOffset - sizeof(size);
+    memcpy(out.data() + sizeOffset, &size, sizeof(size));
+    structures.clear();
+}
+
+void TSymbolTableSnapshotWriter::writeLevel(const TSymbolTableLevel& level)
+{
+    // lazy functions would first have to be made
+    if (level.lazyFunctions != nullptr)
+        ok = false;
+
+    write(level.thisLevel);
+    write(level.anonId);
+
+    // patched below, as anonymous members collapse into their containers and functions into groups
+    size_t countOffset = out.size();
+    write<int>(0);
+
+    int count = 0;
+    std::vector<bool> containerWritten(level.anonId, false);
+    TVector<const TSymbolTableLevel::TLevelSymbol*> sorted;
+    level.getSortedSymbols(sorted);
+    for (auto it = sorted.begin(); it != sorted.end(); ++it) {
+        const TSymbol& symbol = *(*it)->symbol;
+        const TAnonMember* anon = symbol.getAsAnonMember();
+        if (symbol.getAsFunction() != nullptr) {
+            // write the whole overload set with its first function, in name order
+            const TString& name = (*it)->name;
+            size_t parenAt = name.find_first_of('(');
+            const TSymbolTableLevel::TOverloadSet& set = level.overloadSets[level.findOverloadSet(name.c_str(), parenAt)];
+            if (set.functions.front() != symbol.getAsFunction())
+                continue;
+            TVector<const TFunction*> functions;
+            functions.assign(set.functions.begin(), set.functions.end());
+            write<unsigned char>(ESnapshotFunctionGroup);
+            writeFunctionGroup(set.name, functions);
+        } else if (anon != nullptr) {
+            // As with TSymbolTableLevel::clone(), write each container once;
+            // inserting it again brings back all of its members.
+            if (containerWritten[anon->getAnonId()])
+                continue;
+            containerWritten[anon->getAnonId()] = true;
+            write<unsigned char>(ESnapshotAnonContainer);
+            write(anon->getAnonId());
+            writeVariable(anon->getAnonContainer());
+        } else {
+            write<unsigned char>(ESnapshotVariable);
+            writeVariable(*symbol.getAsVariable());
+        }
+        ++count;
+    }
+
+    memcpy(out.data() + countOffset, &count, sizeof(count));
+}
+
+void TSymbolTableSnapshotWriter::writeTable(const TSymbolTable* table)
+{
+    bool present = table != nullptr && table->table.size() > 0;
+    write(present);
+    if (! present)
+        return;
+
+    write(table->uniqueId);
+    write(table->noBuiltInRedeclarations);
+    write(table->separateNameSpaces);
+    write((unsigned int)(table->table.size() - table->adoptedLevels));
+    for (unsigned int level = table->adoptedLevels; level < table->table.size(); ++level)
+        writeLevel(*table->table[level]);
+}
+
+//
+// Reader
+//
+
+TSymbolTableSnapshotReader::TSymbolTableSnapshotReader(const unsigned char* data, size_t size)
+    : data(data), size(size), offset(0)
+{
+}
+
+bool TSymbolTableSnapshotReader::readHeader()
+{
+    TSnapshotHeader header;
+    if (! read(header))
+        return false;
+
+    return header.magic == SnapshotMagic &&
+           header.formatVersion == SnapshotFormatVersion &&
+           header.fingerprint == BuildFingerprint() &&
+           header.payloadSize == size - sizeof(TSnapshotHeader) &&
+           header.checksum == HashFnv(FnvBasis, data + sizeof(TSnapshotHeader), size - sizeof(TSnapshotHeader));
+}
+
+bool TSymbolTableSnapshotReader::readBytes(void* destination, size_t count)
+{
+    if (count > size - offset)
+        return false;
+
+    memcpy(destination, data + offset, count);
+    offset += count;
+
+    return true;
+}
+
+bool TSymbolTableSnapshotReader::readString(TString*& s)
+{
+    int length;
+    if (! read(length))
+        return false;
+
+    if (length < 0) {
+        s = nullptr;
+        return true;
+    }
+    if ((size_t)length > size - offset)
+        return false;
+
+    s = NewPoolTString("");
+    s->assign(reinterpret_cast<const char*>(data + offset), length);
+    offset += length;
+
+    return true;
+}
+
+// Extensions are stored by name, so a snapshot does not depend on the order of the extension ids.
+// Reads one, failing if it is not an extension this build knows.
+bool TSymbolTableSnapshotReader::readExtension(const TExtension*& extension)
+{
+    int length;
+    if (! read(length) || length < 0 || (size_t)length > size - offset)
+        return false;
+
+    extension = FindExtension(std::string(reinterpret_cast<const char*>(data + offset), length).c_str());
+    offset += length;
+
+    return extension != nullptr;
+}
+
+bool TSymbolTableSnapshotReader::readExtensions(TVector<TExtension>& extensions)
+{
+    int numExtensions;
+    if (! read(numExtensions) || numExtensions < 0)
+        return false;
+
+    for (int e = 0; e < numExtensions; ++e) {
+        const TExtension* extension;
+        if (! readExtension(extension))
+            return false;
+        extensions.push_back(*extension);
+    }
+
+    return true;
+}
+
+bool TSymbolTableSnapshotReader::readArraySizes(TArraySizes*& arraySizes)
+{
+    bool present;
+    if (! read(present))
+        return false;
+
+    arraySizes = nullptr;
+    if (! present)
+        return true;
+
+    int numDims;
+    if (! read(numDims) || numDims < 0)
+        return false;
+
+    arraySizes = new TArraySizes;
+    for (int d = 0; d < numDims; ++d) {
+        int dimSize;
+        if (! read(dimSize))
+            return false;
+        arraySizes->addInnerSize(dimSize);
+    }
+
+    int implicitSize;
+    bool variablyIndexed;
+    if (! read(implicitSize) || ! read(variablyIndexed))
+        return false;
+    arraySizes->updateImplicitSize(implicitSize);
+    if (variablyIndexed)
+        arraySizes->setVariablyIndexed();
+
+    return true;
+}
+
+bool TSymbolTableSnapshotReader::readStructure(TTypeList*& structure)
+{
+    unsigned char kind;
+    if (! read(kind))
+        return false;
+
+    structure = nullptr;
+    switch (kind) {
+    case ESnapshotNoStructure:
+        return true;
+    case ESnapshotSharedStructure:
+    {
+        int index;
+        if (! read(index) || index < 0 || index >= (int)structures.size())
+            return false;
+        structure = structures[index];
+        return true;
+    }
+    case ESnapshotNewStructure:
+    {
+        int numMembers;
+        if (! read(numMembers) || numMembers < 0)
+            return false;
+        structure = new TTypeList;
+        structures.push_back(structure);
+        for (int m = 0; m < numMembers; ++m) {
+            TTypeLoc member;
+            member.loc.init();
+            if (! read(member.loc.string) || ! read(member.loc.line) || ! read(member.loc.column))
+                return false;
+            member.type = new TType;
+            if (! readType(*member.type))
+                return false;
+            structure->push_back(member);
+        }
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+bool TSymbolTableSnapshotReader::readType(TType& type)
+{
+    unsigned char basicType;
+    signed char vectorSize, matrixCols, matrixRows;
+    bool vector1, coopmat;
+    if (! read(basicType) || ! read(vectorSize) || ! read(matrixCols) || ! read(matrixRows) ||
+        ! read(vector1) || ! read(coopmat) || basicType >= EbtNumTypes)
+        return false;
+    type.basicType = (TBasicType)basicType;
+    type.vectorSize = vectorSize;
+    type.matrixCols = matrixCols;
+    type.matrixRows = matrixRows;
+    type.vector1 = vector1;
+    type.coopmat = coopmat;
+
+    TString* semanticName;
+    if (! readBytes(&type.qualifier, sizeof(type.qualifier)) || ! readString(semanticName) ||
+        ! readBytes(&type.sampler, sizeof(type.sampler)))
+        return false;
+    type.qualifier.semanticName = semanticName != nullptr ? semanticName->c_str() : nullptr;
+
+    if (! readArraySizes(type.arraySizes) || ! readArraySizes(type.typeParameters))
+        return false;
+
+    TTypeList* structure;
+    if (! readStructure(structure))
+        return false;
+    type.structure = structure;
+
+    return readString(type.fieldName) && readString(type.typeName);
+}
+
+bool TSymbolTableSnapshotReader::readConstArray(TConstUnionArray& constArray)
+{
+    int numConsts;
+    if (! read(numConsts) || numConsts < 0)
+        return false;
+    if (numConsts == 0)
+        return true;
+
+    TConstUnionArray values(numConsts);
+    for (int c = 0; c < numConsts; ++c) {
+        unsigned char constType;
+        long long i64 = 0;
+        unsigned long long u64 = 0;
+        double d = 0.0;
+        bool b = false;
+        if (! read(constType))
+            return false;
+        switch (constType) {
+        case EbtInt8:
+        case EbtInt16:
+        case EbtInt:
+        case EbtInt64:
+            if (! read(i64))
+                return false;
+            break;
+        case EbtUint8:
+        case EbtUint16:
+        case EbtUint:
+        case EbtUint64:
+            if (! read(u64))
+                return false;
+            break;
+        case EbtDouble:
+            if (! read(d))
+                return false;
+            break;
+        case EbtBool:
+            if (! read(b))
+                return false;
+            break;
+        default:
+            return false;
+        }
+
+        switch (constType) {
+        case EbtInt8:   values[c].setI8Const((signed char)i64);     break;
+        case EbtInt16:  values[c].setI16Const((signed short)i64);   break;
+        case EbtInt:    values[c].setIConst((int)i64);              break;
+        case EbtInt64:  values[c].setI64Const(i64);                 break;
+        case EbtUint8:  values[c].setU8Const((unsigned char)u64);   break;
+        case EbtUint16: values[c].setU16Const((unsigned short)u64); break;
+        case EbtUint:   values[c].setUConst((unsigned int)u64);     break;
+        case EbtUint64: values[c].setU64Const(u64);                 break;
+        case EbtDouble: values[c].setDConst(d);                     break;
+        case EbtBool:   values[c].setBConst(b);                     break;
+        }
+    }
+    constArray = values;
+
+    return true;
+}
+
+TVariable* TSymbolTableSnapshotReader::readVariable()
+{
+    TString* name;
+    int uniqueId;
+    TType type;
+    bool userType;
+    if (! readString(name) || name == nullptr || ! read(uniqueId) || ! readType(type) || ! read(userType))
+        return nullptr;
+
+    TVariable* variable = new TVariable(name, type, userType);
+    variable->setUniqueId(uniqueId);
+
+    TVector<TExtension> extensions;
+    if (! readExtensions(extensions))
+        return nullptr;
+    if (extensions.size() > 0)
+        variable->setExtensions((int)extensions.size(), extensions.data());
+
+    bool hasMemberExtensions;
+    if (! read(hasMemberExtensions))
+        return nullptr;
+    if (hasMemberExtensions) {
+        if (! type.isStruct())
+            return nullptr;
+        for (int m = 0; m < (int)type.getStruct()->size(); ++m) {
+            TVector<TExtension> memberExtensions;
+            if (! readExtensions(memberExtensions))
+                return nullptr;
+            if (memberExtensions.size() > 0)
+                variable->setMemberExtensions(m, (int)memberExtensions.size(), memberExtensions.data());
+        }
+    }
+
+    if (! readConstArray(variable->constArray))
+        return nullptr;
+
+    return variable;
+}
+
+TFunction* TSymbolTableSnapshotReader::readFunction()
+{
+    TString* name;
+    TString* mangledName;
+    int uniqueId;
+    TType returnType;
+    if (! readString(name) || name == nullptr || ! readString(mangledName) || mangledName == nullptr ||
+        ! read(uniqueId) || ! readType(returnType))
+        return nullptr;
+
+    TFunction* function = new TFunction(name, returnType);
+    function->mangledName = *mangledName;
+    function->setUniqueId(uniqueId);
+    if (! read(function->declaredBuiltIn) || ! read(function->op) ||
+        ! read(function->defined) || ! read(function->prototyped) ||
+        ! read(function->implicitThis) || ! read(function->illegalImplicitThis))
+        return nullptr;
+
+    TVector<TExtension> extensions;
+    if (! readExtensions(extensions))
+        return nullptr;
+    if (extensions.size() > 0)
+        function->setExtensions((int)extensions.size(), extensions.data());
+
+    int numParams;
+    if (! read(numParams) || numParams < 0)
+        return nullptr;
+    for (int p = 0; p < numParams; ++p) {
+        TParameter param = { nullptr, new TType, nullptr };
+        if (! readString(param.name) || ! readType(*param.type))
+            return nullptr;
+        function->parameters.push_back(param);
+    }
+
+    return function;
+}
+
+// Record a function group, without decoding it.
+bool TSymbolTableSnapshotReader::readFunctionGroup(TSymbolTableLevel& level)
+{
+    TString* baseName;
+    int count;
+    unsigned long long groupSize;
+    if (! readString(baseName) || baseName == nullptr || ! read(count) || count < 0 ||
+        ! read(groupSize) || groupSize > size - offset)
+        return false;
+
+    // check the group now: publishing one that fails to decode later would lose all its overloads
+    TSymbolTableSnapshotReader checker(data + offset, (size_t)groupSize);
+    if (! checker.checkFunctions(count))
+        return false;
+
+    // keep a copy of the encoding, in the same pool as the tables it belongs to
+    unsigned char* groupData = static_cast<unsigned char*>(GetThreadPoolAllocator().allocate((size_t)groupSize));
+    memcpy(groupData, data + offset, (size_t)groupSize);
+    offset += (size_t)groupSize;
+
+    if (level.lazyFunctions == nullptr)
+        level.lazyFunctions = NewPoolObject(level.lazyFunctions);
+    TLazyFunctionGroup* group = new TLazyFunctionGroup(groupData, (size_t)groupSize, count, GetThreadPoolAllocator());
+
+    return level.lazyFunctions->insert(std::make_pair(*baseName, group)).second;
+}
+
+bool TSymbolTableSnapshotReader::readFunctions(int count, TVector<TFunction*>& functions)
+{
+    for (int f = 0; f < count; ++f) {
+        TFunction* function = readFunction();
+        if (function == nullptr)
+            return false;
+        function->makeReadOnly();
+        functions.push_back(function);
+    }
+
+    return offset == size;
+}
+
+bool TSymbolTableSnapshotReader::skipBytes(size_t count)
+{
+    if (count > size - offset)
+        return false;
+
+    offset += count;
+
+    return true;
+}
+
+bool TSymbolTableSnapshotReader::checkString(bool& present)
+{
+    int length;
+    if (! read(length))
+        return false;
+
+    present = length >= 0;
+
+    return ! present || skipBytes((size_t)length);
+}
+
+bool TSymbolTableSnapshotReader::checkExtensions()
+{
+    int numExtensions;
+    if (! read(numExtensions) || numExtensions < 0)
+        return false;
+
+    for (int e = 0; e < numExtensions; ++e) {
+        const TExtension* extension;
+        if (! readExtension(extension))
+            return false;
+    }
+
+    return true;
+}
+
+bool TSymbolTableSnapshotReader::checkArraySizes()
+{
+    bool present;
+    if (! read(present))
+        return false;
+    if (! present)
+        return true;
+
+    int numDims;
+    if (! read(numDims) || numDims < 0)
+        return false;
+
+    int dimSize;
+    int implicitSize;
+    bool variablyIndexed;
+
+    return skipBytes((size_t)numDims * sizeof(dimSize)) && read(implicitSize) && read(variablyIndexed);
+}
+
+bool TSymbolTableSnapshotReader::checkStructure(int& numStructures)
+{
+    unsigned char kind;
+    if (! read(kind))
+        return false;
+
+    switch (kind) {
+    case ESnapshotNoStructure:
+        return true;
+    case ESnapshotSharedStructure:
+    {
+        int index;
+        return read(index) && index >= 0 && index < numStructures;
+    }
+    case ESnapshotNewStructure:
+    {
+        int numMembers;
+        if (! read(numMembers) || numMembers < 0)
+            return false;
+        ++numStructures;
+        for (int m = 0; m < numMembers; ++m) {
+            TSourceLoc loc;
+            if (! read(loc.string) || ! read(loc.line) || ! read(loc.column) || ! checkType(numStructures))
+                return false;
+        }
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+bool TSymbolTableSnapshotReader::checkType(int& numStructures)
+{
+    unsigned char basicType;
+    signed char vectorSize, matrixCols, matrixRows;
+    bool vector1, coopmat;
+    if (! read(basicType) || ! read(vectorSize) || ! read(matrixCols) || ! read(matrixRows) ||
+        ! read(vector1) || ! read(coopmat) || basicType >= EbtNumTypes)
+        return false;
+
+    bool semanticName;
+    if (! skipBytes(sizeof(TQualifier)) || ! checkString(semanticName) || ! skipBytes(sizeof(TSampler)))
+        return false;
+
+    if (! checkArraySizes() || ! checkArraySizes() || ! checkStructure(numStructures))
+        return false;
+
+    bool fieldName, typeName;
+
+    return checkString(fieldName) && checkString(typeName);
+}
+
+bool TSymbolTableSnapshotReader::checkFunction(int& numStructures)
+{
+    bool name, mangledName;
+    int uniqueId;
+    if (! checkString(name) || ! name || ! checkString(mangledName) || ! mangledName ||
+        ! read(uniqueId) || ! checkType(numStructures))
+        return false;
+
+    TBuiltInVariable declaredBuiltIn;
+    TOperator op;
+    bool defined, prototyped, implicitThis, illegalImplicitThis;
+    if (! read(declaredBuiltIn) || ! read(op) || ! read(defined) || ! read(prototyped) ||
+        ! read(implicitThis) || ! read(illegalImplicitThis) || ! checkExtensions())
+        return false;
+
+    int numParams;
+    if (! read(numParams) || numParams < 0)
+        return false;
+    for (int p = 0; p < numParams; ++p) {
+        bool paramName;
+        if (! checkString(paramName) || ! checkType(numStructures))
+            return false;
+    }
+
+    return true;
+}
+
+bool TSymbolTableSnapshotReader::checkFunctions(int count)
+{
+    // the group's structures are numbered within the group, across its functions
+    int numStructures = 0;
+    for (int f = 0; f < count; ++f) {
+        if (! checkFunction(numStructures))
+            return false;
+    }
+
+    return offset == size;
+}
+
+bool TSymbolTableSnapshotReader::readLevel(TSymbolTableLevel& level)
+{
+    int anonId;
+    int numSymbols;
+    if (! read(level.thisLevel) || ! read(anonId) || ! read(numSymbols) || numSymbols < 0)
+        return false;
+
+    for (int s = 0; s < numSymbols; ++s) {
+        unsigned char kind;
+        if (! read(kind))
+            return false;
+
+        if (kind == ESnapshotFunctionGroup) {
+            if (! readFunctionGroup(level))
+                return false;
+            continue;
+        }
+
+        TSymbol* symbol = nullptr;
+        switch (kind) {
+        case ESnapshotVariable:
+            symbol = readVariable();
+            break;
+        case ESnapshotAnonContainer:
+            // insert() hands out the next anonymous id, so line it up with the recorded one
+            if (! read(level.anonId))
+                return false;
+            symbol = readVariable();
+            if (symbol != nullptr) {
+                if (! symbol->getType().isStruct())
+                    return false;
+                symbol->changeName(NewPoolTString(""));
+            }
+            break;
+        default:
+            break;
+        }
+        if (symbol == nullptr)
+            return false;
+
+        level.insert(*symbol, false);
+    }
+    level.anonId = anonId;
+
+    return true;
+}
+
+bool TSymbolTableSnapshotReader::readTable(TSymbolTable*& table, TSymbolTable* adoptFrom)
+{
+    table = nullptr;
+
+    bool present;
+    if (! read(present))
+        return false;
+    if (! present)
+        return true;
+
+    table = new TSymbolTable;
+    if (adoptFrom != nullptr)
+        table->adoptLevels(*adoptFrom);
+
+    unsigned int numLevels;
+    if (! read(table->uniqueId) || ! read(table->noBuiltInRedeclarations) || ! read(table->separateNameSpaces) ||
+        ! read(numLevels))
+        return false;
+
+    for (unsigned int l = 0; l < numLevels; ++l) {
+        TSymbolTableLevel* level = new TSymbolTableLevel;
+        table->table.push_back(level);
+        if (! readLevel(*level))
+            return false;
+    }
+
+    return true;
+}
+
+//
+// Lazy function groups
+//
+
+const TVector<TFunction*>& TLazyFunctionGroup::getFunctions()
+{
+    if (made.load(std::memory_order_acquire))
+        return functions;
+
+    // The tables are shared by all threads, and so is the pool they come from.
+    GetGlobalLock();
+    if (! made.load(std::memory_order_relaxed)) {
+        TPoolAllocator& previousAllocator = GetThreadPoolAllocator();
+        SetThreadPoolAllocator(&pool);
+
+        TSymbolTableSnapshotReader reader(data, size);
+        bool decoded = reader.readFunctions(count, functions);
+        assert(decoded);
+        (void)decoded;
+
+        SetThreadPoolAllocator(&previousAllocator);
+        made.store(true, std::memory_order_release);
+    }
+    ReleaseGlobalLock();
+
+    return functions;
+}
+
+} // end namespace glslang
+
+#endif // GLSLANG_WEB
@@ -0,0 +1,196 @@
+//
+// Copyright (C) 2020 The Khronos Group Inc.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//    Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+//    Redistributions in binary form must reproduce the above
+//    copyright notice, this list of conditions and the following
+//    disclaimer in the documentation and/or other materials provided
+//    with the distribution.
+//
+//    Neither the name of 3Dlabs Inc. Ltd. nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef GLSLANG_WEB
+
+#ifndef _SYMBOL_TABLE_SNAPSHOT_INCLUDED_
+#define _SYMBOL_TABLE_SNAPSHOT_INCLUDED_
+
+//
+// Binary snapshots of fully built, shareable (built-in) symbol tables.
+//
+// Generating the built-in symbol tables means building and parsing a very large
+// amount of declaration text for each version/profile/SPIR-V/source combination.
+// A snapshot records the resulting tables in a compact binary form that can be
+// loaded back directly into a pool, skipping both the text generation and the parse.
+//
+// Layout:
+//     header:  magic, format version, build fingerprint, payload size, payload checksum
+//     payload: a sequence of tables, each either absent, or its non-adopted levels
+//
+// The fingerprint covers the in-memory layout of the types written raw
+// (qualifiers, samplers) and the enumerant ranges stored as numbers, so a
+// snapshot from an incompatible build is rejected rather than misread.
+//
+// Functions are written in self-contained groups, one per base name.  When
+// reading, a group is only checked, then kept as a TLazyFunctionGroup and decoded
+// the first time its name is looked up.  A typical shader uses a few dozen of
+// the thousands of built-in functions.
+//
+
+#include <atomic>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "SymbolTable.h"
+
+namespace glslang {
+
+class TSymbolTableSnapshotWriter {
+public:
+    explicit TSymbolTableSnapshotWriter(std::vector<unsigned char>& out);
+
+    // Append a table; nullptr or an empty table is recorded as absent.
+    // Only the levels the table owns are written, not those it adopted.
+    void writeTable(const TSymbolTable* table);
+
+    // Complete the header.  Returns false if anything written could not be
+    // represented, in which case the output must not be used.
+    bool finish();
+
+protected:
+    void writeLevel(const TSymbolTableLevel&);
+    void writeFunctionGroup(const TString& baseName, const TVector<const TFunction*>& functions);
+    void writeVariable(const TVariable&);
+    void writeFunction(const TFunction&);
+    void writeType(const TType&);
+    void writeArraySizes(const TArraySizes*);
+    void writeStructure(const TTypeList*);
+    void writeConstArray(const TConstUnionArray&);
+    void writeExtensions(int numExtensions, const TExtension* extensions);
+    void writeString(const TString*);
+    void writeString(const char*);
+    void writeBytes(const void* data, size_t size);
+    template<class T> void write(T value) { writeBytes(&value, sizeof(value)); }
+
+    std::vector<unsigned char>& out;
+    std::map<const TTypeList*, int> structures;  // already written structures, to preserve sharing
+    bool ok;
+
+private:
+    TSymbolTableSnapshotWriter(const TSymbolTableSnapshotWriter&);
+    TSymbolTableSnapshotWriter& operator=(const TSymbolTableSnapshotWriter&);
+};
+
+//
+// Reads what TSymbolTableSnapshotWriter wrote.  All objects created are allocated
+// from the current thread's pool allocator, which must be the pool meant to own
+// the resulting tables.
+//
+class TSymbolTableSnapshotReader {
+public:
+    TSymbolTableSnapshotReader(const unsigned char* data, size_t size);
+
+    // Validate the header against this build.  Must be called first.
+    bool readHeader();
+
+    // Read the next table.  'table' is set to nullptr if the table was written as absent;
+    // otherwise a new table is made, first adopting the levels of 'adoptFrom', if given.
+    bool readTable(TSymbolTable*& table, TSymbolTable* adoptFrom);
+
+    // Read the functions of one function group.
+    bool readFunctions(int count, TVector<TFunction*>& functions);
+
+protected:
+    bool readLevel(TSymbolTableLevel&);
+    bool readFunctionGroup(TSymbolTableLevel&);
+    TVariable* readVariable();
+    TFunction* readFunction();
+    bool readType(TType&);
+    bool readArraySizes(TArraySizes*&);
+    bool readStructure(TTypeList*&);
+    bool readConstArray(TConstUnionArray&);
+    bool readExtension(const TExtension*&);
+    bool readExtensions(TVector<TExtension>&);
+    bool readString(TString*&);
+    bool readBytes(void* data, size_t size);
+
+    // Walk the encoding of a function group as readFunctions() would, making
+    // nothing, so a bad group is caught when the snapshot is loaded rather than
+    // when the group is first looked up.  Must stay in step with the read*() methods.
+    bool checkFunctions(int count);
+    bool checkFunction(int& numStructures);
+    bool checkType(int& numStructures);
+    bool checkArraySizes();
+    bool checkStructure(int& numStructures);
+    bool checkExtensions();
+    bool checkString(bool& present);
+    bool skipBytes(size_t size);
+    template<class T> bool read(T& value) { return readBytes(&value, sizeof(value)); }
+
+    const unsigned char* data;
+    size_t size;
+    size_t offset;
+    std::vector<TTypeList*> structures;
+
+private:
+    TSymbolTableSnapshotReader(const TSymbolTableSnapshotReader&);
+    TSymbolTableSnapshotReader& operator=(const TSymbolTableSnapshotReader&);
+};
+
+//
+// The still encoded functions of one base name, as read from a snapshot.
+//
+class TLazyFunctionGroup {
+public:
+    POOL_ALLOCATOR_NEW_DELETE(GetThreadPoolAllocator())
+
+    // 'data' must stay valid for the life of the group; new functions are allocated from 'pool'.
+    TLazyFunctionGroup(const unsigned char* data, size_t size, int count, TPoolAllocator& pool)
+        : data(data), size(size), count(count), pool(pool), made(false) { }
+
+    // Get the functions, decoding them if this is the first use.  Safe to call from multiple threads.
+    // The group was checked when it was read, so decoding it cannot fail.
+    const TVector<TFunction*>& getFunctions();
+
+protected:
+    const unsigned char* data;
+    size_t size;
+    int count;
+    TPoolAllocator& pool;
+    std::atomic<bool> made;
+    TVector<TFunction*> functions;
+
+private:
+    TLazyFunctionGroup(const TLazyFunctionGroup&);
+    TLazyFunctionGroup& operator=(const TLazyFunctionGroup&);
+};
+
+} // end namespace glslang
+
+#endif // _SYMBOL_TABLE_SNAPSHOT_INCLUDED_
+
+#endif // GLSLANG_WEB
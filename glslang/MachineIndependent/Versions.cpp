@@ -74,16 +74,18 @@
 //    However, if symbols specific to the extension are added (step 5), they will
 //    only be added under tests that the minimum version and profile are present.
 //
-// 1) Add a symbol name for the extension string at the bottom of Versions.h:
+// 1) Add an id for the extension to TExtensionId in Versions.h, in the same position
+//    it will take in the Extensions[] table below, and a symbol name for the extension
+//    string at the bottom of Versions.h:
 //
-//     const char* const XXX_extension_X = "XXX_extension_X";
+//     EExt_XXX_extension_X,
+//     constexpr TExtension XXX_extension_X = { "XXX_extension_X", EExt_XXX_extension_X };
 //
-// 2) Add extension initialization to TParseVersions::initializeExtensionBehavior(),
-//    the first function below and optionally a entry to extensionData for additional
-//    error checks:
+// 2) Add the extension, with its initial behavior, to the Extensions[] table below, and
+//    optionally the minimum SPIR-V version it needs, for additional error checks:
 //
-//     extensionBehavior[XXX_extension_X] = EBhDisable;
-//     (Optional) exts[] = {XXX_extension_X, EShTargetSpv_1_4}
+//     { XXX_extension_X, EBhDisable },
+//     (Optional) { XXX_extension_X, EBhDisable, EShTargetSpv_1_4 },
 //
 // 3) Add any preprocessor directives etc. in the next function, TParseVersions::getPreamble():
 //
@@ -149,204 +151,271 @@
 #include "parseVersions.h"
 #include "localintermediate.h"
 
+#include <algorithm>
+#include <cstring>
+
 namespace glslang {
 
 #ifndef GLSLANG_WEB
 
+namespace {
+
+struct TExtensionInfo {
+    constexpr TExtensionInfo(TExtension extension, TExtensionBehavior initialBehavior, unsigned int minSpvVersion = 0)
+        : extension(extension), initialBehavior(initialBehavior), minSpvVersion(minSpvVersion) { }
+
+    TExtension extension;
+    TExtensionBehavior initialBehavior;
+    unsigned int minSpvVersion;    // 0 if any SPIR-V version will do
+};
+
 //
-// Initialize all extensions, almost always to 'disable', as once their features
+// All extensions, with their initial behavior, almost always 'disable', as once their features
 // are incorporated into a core version, their features are supported through allowing that
 // core version, not through a pseudo-enablement of the extension.
 //
-void TParseVersions::initializeExtensionBehavior()
-{
-    typedef struct {
-        const char *const extensionName;
-        EShTargetLanguageVersion minSpvVersion;
-    } extensionData;
-
-    const extensionData exts[] = { {E_GL_EXT_ray_tracing, EShTargetSpv_1_4} };
-
-    for (int ii = 0; ii < sizeof(exts) / sizeof(exts[0]); ii++) {
-        // Add only extensions which require > spv1.0 to save space in map
-        if (exts[ii].minSpvVersion > EShTargetSpv_1_0) {
-            extensionMinSpv[E_GL_EXT_ray_tracing] = exts[ii].minSpvVersion;
-        }
-    }
-
-    extensionBehavior[E_GL_OES_texture_3D]                   = EBhDisable;
-    extensionBehavior[E_GL_OES_standard_derivatives]         = EBhDisable;
-    extensionBehavior[E_GL_EXT_frag_depth]                   = EBhDisable;
-    extensionBehavior[E_GL_OES_EGL_image_external]           = EBhDisable;
-    extensionBehavior[E_GL_OES_EGL_image_external_essl3]     = EBhDisable;
-    extensionBehavior[E_GL_EXT_YUV_target]                   = EBhDisable;
-    extensionBehavior[E_GL_EXT_shader_texture_lod]           = EBhDisable;
-    extensionBehavior[E_GL_EXT_shadow_samplers]              = EBhDisable;
-    extensionBehavior[E_GL_ARB_texture_rectangle]            = EBhDisable;
-    extensionBehavior[E_GL_3DL_array_objects]                = EBhDisable;
-    extensionBehavior[E_GL_ARB_shading_language_420pack]     = EBhDisable;
-    extensionBehavior[E_GL_ARB_texture_gather]               = EBhDisable;
-    extensionBehavior[E_GL_ARB_gpu_shader5]                  = EBhDisablePartial;
-    extensionBehavior[E_GL_ARB_separate_shader_objects]      = EBhDisable;
-    extensionBehavior[E_GL_ARB_compute_shader]               = EBhDisable;
-    extensionBehavior[E_GL_ARB_tessellation_shader]          = EBhDisable;
-    extensionBehavior[E_GL_ARB_enhanced_layouts]             = EBhDisable;
-    extensionBehavior[E_GL_ARB_texture_cube_map_array]       = EBhDisable;
-    extensionBehavior[E_GL_ARB_texture_multisample]          = EBhDisable;
-    extensionBehavior[E_GL_ARB_shader_texture_lod]           = EBhDisable;
-    extensionBehavior[E_GL_ARB_explicit_attrib_location]     = EBhDisable;
-    extensionBehavior[E_GL_ARB_explicit_uniform_location]    = EBhDisable;
-    extensionBehavior[E_GL_ARB_shader_image_load_store]      = EBhDisable;
-    extensionBehavior[E_GL_ARB_shader_atomic_counters]       = EBhDisable;
-    extensionBehavior[E_GL_ARB_shader_draw_parameters]       = EBhDisable;
-    extensionBehavior[E_GL_ARB_shader_group_vote]            = EBhDisable;
-    extensionBehavior[E_GL_ARB_derivative_control]           = EBhDisable;
-    extensionBehavior[E_GL_ARB_shader_texture_image_samples] = EBhDisable;
-    extensionBehavior[E_GL_ARB_viewport_array]               = EBhDisable;
-    extensionBehavior[E_GL_ARB_gpu_shader_int64]             = EBhDisable;
-    extensionBehavior[E_GL_ARB_gpu_shader_fp64]              = EBhDisable;
-    extensionBehavior[E_GL_ARB_shader_ballot]                = EBhDisable;
-    extensionBehavior[E_GL_ARB_sparse_texture2]              = EBhDisable;
-    extensionBehavior[E_GL_ARB_sparse_texture_clamp]         = EBhDisable;
-    extensionBehavior[E_GL_ARB_shader_stencil_export]        = EBhDisable;
-//    extensionBehavior[E_GL_ARB_cull_distance]                = EBhDisable;    // present for 4.5, but need extension control over block members
-    extensionBehavior[E_GL_ARB_post_depth_coverage]          = EBhDisable;
-    extensionBehavior[E_GL_ARB_shader_viewport_layer_array]  = EBhDisable;
-    extensionBehavior[E_GL_ARB_fragment_shader_interlock]    = EBhDisable;
-    extensionBehavior[E_GL_ARB_shader_clock]                 = EBhDisable;
-    extensionBehavior[E_GL_ARB_uniform_buffer_object]        = EBhDisable;
-    extensionBehavior[E_GL_ARB_sample_shading]               = EBhDisable;
-    extensionBehavior[E_GL_ARB_shader_bit_encoding]          = EBhDisable;
-    extensionBehavior[E_GL_ARB_shader_image_size]            = EBhDisable;
-    extensionBehavior[E_GL_ARB_shader_storage_buffer_object] = EBhDisable;
-    extensionBehavior[E_GL_ARB_shading_language_packing]     = EBhDisable;
-    extensionBehavior[E_GL_ARB_texture_query_lod]            = EBhDisable;
-    extensionBehavior[E_GL_ARB_vertex_attrib_64bit]          = EBhDisable;
-
-    extensionBehavior[E_GL_KHR_shader_subgroup_basic]            = EBhDisable;
-    extensionBehavior[E_GL_KHR_shader_subgroup_vote]             = EBhDisable;
-    extensionBehavior[E_GL_KHR_shader_subgroup_arithmetic]       = EBhDisable;
-    extensionBehavior[E_GL_KHR_shader_subgroup_ballot]           = EBhDisable;
-    extensionBehavior[E_GL_KHR_shader_subgroup_shuffle]          = EBhDisable;
-    extensionBehavior[E_GL_KHR_shader_subgroup_shuffle_relative] = EBhDisable;
-    extensionBehavior[E_GL_KHR_shader_subgroup_clustered]        = EBhDisable;
-    extensionBehavior[E_GL_KHR_shader_subgroup_quad]             = EBhDisable;
-    extensionBehavior[E_GL_KHR_memory_scope_semantics]           = EBhDisable;
-
-    extensionBehavior[E_GL_EXT_shader_atomic_int64]              = EBhDisable;
-
-    extensionBehavior[E_GL_EXT_shader_non_constant_global_initializers] = EBhDisable;
-    extensionBehavior[E_GL_EXT_shader_image_load_formatted]             = EBhDisable;
-    extensionBehavior[E_GL_EXT_post_depth_coverage]                     = EBhDisable;
-    extensionBehavior[E_GL_EXT_control_flow_attributes]                 = EBhDisable;
-    extensionBehavior[E_GL_EXT_nonuniform_qualifier]                    = EBhDisable;
-    extensionBehavior[E_GL_EXT_samplerless_texture_functions]           = EBhDisable;
-    extensionBehavior[E_GL_EXT_scalar_block_layout]                     = EBhDisable;
-    extensionBehavior[E_GL_EXT_fragment_invocation_density]             = EBhDisable;
-    extensionBehavior[E_GL_EXT_buffer_reference]                        = EBhDisable;
-    extensionBehavior[E_GL_EXT_buffer_reference2]                       = EBhDisable;
-    extensionBehavior[E_GL_EXT_buffer_reference_uvec2]                  = EBhDisable;
-    extensionBehavior[E_GL_EXT_demote_to_helper_invocation]             = EBhDisable;
-    extensionBehavior[E_GL_EXT_debug_printf]                            = EBhDisable;
-
-    extensionBehavior[E_GL_EXT_shader_16bit_storage]                    = EBhDisable;
-    extensionBehavior[E_GL_EXT_shader_8bit_storage]                     = EBhDisable;
+// An extension's id is its index in this table.
+//
+constexpr TExtensionInfo Extensions[] = {
+    { E_GL_OES_texture_3D,                   EBhDisable },
+    { E_GL_OES_standard_derivatives,         EBhDisable },
+    { E_GL_EXT_frag_depth,                   EBhDisable },
+    { E_GL_OES_EGL_image_external,           EBhDisable },
+    { E_GL_OES_EGL_image_external_essl3,     EBhDisable },
+    { E_GL_EXT_YUV_target,                   EBhDisable },
+    { E_GL_EXT_shader_texture_lod,           EBhDisable },
+    { E_GL_EXT_shadow_samplers,              EBhDisable },
+    { E_GL_ARB_texture_rectangle,            EBhDisable },
+    { E_GL_3DL_array_objects,                EBhDisable },
+    { E_GL_ARB_shading_language_420pack,     EBhDisable },
+    { E_GL_ARB_texture_gather,               EBhDisable },
+    { E_GL_ARB_gpu_shader5,                  EBhDisablePartial },
+    { E_GL_ARB_separate_shader_objects,      EBhDisable },
+    { E_GL_ARB_compute_shader,               EBhDisable },
+    { E_GL_ARB_tessellation_shader,          EBhDisable },
+    { E_GL_ARB_enhanced_layouts,             EBhDisable },
+    { E_GL_ARB_texture_cube_map_array,       EBhDisable },
+    { E_GL_ARB_texture_multisample,          EBhDisable },
+    { E_GL_ARB_shader_texture_lod,           EBhDisable },
+    { E_GL_ARB_explicit_attrib_location,     EBhDisable },
+    { E_GL_ARB_explicit_uniform_location,    EBhDisable },
+    { E_GL_ARB_shader_image_load_store,      EBhDisable },
+    { E_GL_ARB_shader_atomic_counters,       EBhDisable },
+    { E_GL_ARB_shader_draw_parameters,       EBhDisable },
+    { E_GL_ARB_shader_group_vote,            EBhDisable },
+    { E_GL_ARB_derivative_control,           EBhDisable },
+    { E_GL_ARB_shader_texture_image_samples, EBhDisable },
+    { E_GL_ARB_viewport_array,               EBhDisable },
+    { E_GL_ARB_gpu_shader_int64,             EBhDisable },
+    { E_GL_ARB_gpu_shader_fp64,              EBhDisable },
+    { E_GL_ARB_shader_ballot,                EBhDisable },
+    { E_GL_ARB_sparse_texture2,              EBhDisable },
+    { E_GL_ARB_sparse_texture_clamp,         EBhDisable },
+    { E_GL_ARB_shader_stencil_export,        EBhDisable },
+//    { E_GL_ARB_cull_distance,                EBhDisable },    // present for 4.5, but need extension control over block members
+    { E_GL_ARB_post_depth_coverage,          EBhDisable },
+    { E_GL_ARB_shader_viewport_layer_array,  EBhDisable },
+    { E_GL_ARB_fragment_shader_interlock,    EBhDisable },
+    { E_GL_ARB_shader_clock,                 EBhDisable },
+    { E_GL_ARB_uniform_buffer_object,        EBhDisable },
+    { E_GL_ARB_sample_shading,               EBhDisable },
+    { E_GL_ARB_shader_bit_encoding,          EBhDisable },
+    { E_GL_ARB_shader_image_size,            EBhDisable },
+    { E_GL_ARB_shader_storage_buffer_object, EBhDisable },
+    { E_GL_ARB_shading_language_packing,     EBhDisable },
+    { E_GL_ARB_texture_query_lod,            EBhDisable },
+    { E_GL_ARB_vertex_attrib_64bit,          EBhDisable },
+
+    { E_GL_KHR_shader_subgroup_basic,            EBhDisable },
+    { E_GL_KHR_shader_subgroup_vote,             EBhDisable },
+    { E_GL_KHR_shader_subgroup_arithmetic,       EBhDisable },
+    { E_GL_KHR_shader_subgroup_ballot,           EBhDisable },
+    { E_GL_KHR_shader_subgroup_shuffle,          EBhDisable },
+    { E_GL_KHR_shader_subgroup_shuffle_relative, EBhDisable },
+    { E_GL_KHR_shader_subgroup_clustered,        EBhDisable },
+    { E_GL_KHR_shader_subgroup_quad,             EBhDisable },
+    { E_GL_KHR_memory_scope_semantics,           EBhDisable },
+
+    { E_GL_EXT_shader_atomic_int64,              EBhDisable },
+
+    { E_GL_EXT_shader_non_constant_global_initializers, EBhDisable },
+    { E_GL_EXT_shader_image_load_formatted,             EBhDisable },
+    { E_GL_EXT_post_depth_coverage,                     EBhDisable },
+    { E_GL_EXT_control_flow_attributes,                 EBhDisable },
+    { E_GL_EXT_nonuniform_qualifier,                    EBhDisable },
+    { E_GL_EXT_samplerless_texture_functions,           EBhDisable },
+    { E_GL_EXT_scalar_block_layout,                     EBhDisable },
+    { E_GL_EXT_fragment_invocation_density,             EBhDisable },
+    { E_GL_EXT_buffer_reference,                        EBhDisable },
+    { E_GL_EXT_buffer_reference2,                       EBhDisable },
+    { E_GL_EXT_buffer_reference_uvec2,                  EBhDisable },
+    { E_GL_EXT_demote_to_helper_invocation,             EBhDisable },
+    { E_GL_EXT_debug_printf,                            EBhDisable },
+
+    { E_GL_EXT_shader_16bit_storage,                    EBhDisable },
+    { E_GL_EXT_shader_8bit_storage,                     EBhDisable },
 
     // #line and #include
-    extensionBehavior[E_GL_GOOGLE_cpp_style_line_directive]          = EBhDisable;
-    extensionBehavior[E_GL_GOOGLE_include_directive]                 = EBhDisable;
-
-    extensionBehavior[E_GL_AMD_shader_ballot]                        = EBhDisable;
-    extensionBehavior[E_GL_AMD_shader_trinary_minmax]                = EBhDisable;
-    extensionBehavior[E_GL_AMD_shader_explicit_vertex_parameter]     = EBhDisable;
-    extensionBehavior[E_GL_AMD_gcn_shader]                           = EBhDisable;
-    extensionBehavior[E_GL_AMD_gpu_shader_half_float]                = EBhDisable;
-    extensionBehavior[E_GL_AMD_texture_gather_bias_lod]              = EBhDisable;
-    extensionBehavior[E_GL_AMD_gpu_shader_int16]                     = EBhDisable;
-    extensionBehavior[E_GL_AMD_shader_image_load_store_lod]          = EBhDisable;
-    extensionBehavior[E_GL_AMD_shader_fragment_mask]                 = EBhDisable;
-    extensionBehavior[E_GL_AMD_gpu_shader_half_float_fetch]          = EBhDisable;
-
-    extensionBehavior[E_GL_INTEL_shader_integer_functions2]          = EBhDisable;
-
-    extensionBehavior[E_GL_NV_sample_mask_override_coverage]         = EBhDisable;
-    extensionBehavior[E_SPV_NV_geometry_shader_passthrough]          = EBhDisable;
-    extensionBehavior[E_GL_NV_viewport_array2]                       = EBhDisable;
-    extensionBehavior[E_GL_NV_stereo_view_rendering]                 = EBhDisable;
-    extensionBehavior[E_GL_NVX_multiview_per_view_attributes]        = EBhDisable;
-    extensionBehavior[E_GL_NV_shader_atomic_int64]                   = EBhDisable;
-    extensionBehavior[E_GL_NV_conservative_raster_underestimation]   = EBhDisable;
-    extensionBehavior[E_GL_NV_shader_noperspective_interpolation]    = EBhDisable;
-    extensionBehavior[E_GL_NV_shader_subgroup_partitioned]           = EBhDisable;
-    extensionBehavior[E_GL_NV_shading_rate_image]                    = EBhDisable;
-    extensionBehavior[E_GL_NV_ray_tracing]                           = EBhDisable;
-    extensionBehavior[E_GL_NV_fragment_shader_barycentric]           = EBhDisable;
-    extensionBehavior[E_GL_NV_compute_shader_derivatives]            = EBhDisable;
-    extensionBehavior[E_GL_NV_shader_texture_footprint]              = EBhDisable;
-    extensionBehavior[E_GL_NV_mesh_shader]                           = EBhDisable;
-
-    extensionBehavior[E_GL_NV_cooperative_matrix]                    = EBhDisable;
-    extensionBehavior[E_GL_NV_shader_sm_builtins]                    = EBhDisable;
-    extensionBehavior[E_GL_NV_integer_cooperative_matrix]            = EBhDisable;
+    { E_GL_GOOGLE_cpp_style_line_directive,          EBhDisable },
+    { E_GL_GOOGLE_include_directive,                 EBhDisable },
+
+    { E_GL_AMD_shader_ballot,                        EBhDisable },
+    { E_GL_AMD_shader_trinary_minmax,                EBhDisable },
+    { E_GL_AMD_shader_explicit_vertex_parameter,     EBhDisable },
+    { E_GL_AMD_gcn_shader,                           EBhDisable },
+    { E_GL_AMD_gpu_shader_half_float,                EBhDisable },
+    { E_GL_AMD_texture_gather_bias_lod,              EBhDisable },
+    { E_GL_AMD_gpu_shader_int16,                     EBhDisable },
+    { E_GL_AMD_shader_image_load_store_lod,          EBhDisable },
+    { E_GL_AMD_shader_fragment_mask,                 EBhDisable },
+    { E_GL_AMD_gpu_shader_half_float_fetch,          EBhDisable },
+
+    { E_GL_INTEL_shader_integer_functions2,          EBhDisable },
+
+    { E_GL_NV_sample_mask_override_coverage,         EBhDisable },
+    { E_SPV_NV_geometry_shader_passthrough,          EBhDisable },
+    { E_GL_NV_viewport_array2,                       EBhDisable },
+    { E_GL_NV_stereo_view_rendering,                 EBhDisable },
+    { E_GL_NVX_multiview_per_view_attributes,        EBhDisable },
+    { E_GL_NV_shader_atomic_int64,                   EBhDisable },
+    { E_GL_NV_conservative_raster_underestimation,   EBhDisable },
+    { E_GL_NV_shader_noperspective_interpolation,    EBhDisable },
+    { E_GL_NV_shader_subgroup_partitioned,           EBhDisable },
+    { E_GL_NV_shading_rate_image,                    EBhDisable },
+    { E_GL_NV_ray_tracing,                           EBhDisable },
+    { E_GL_NV_fragment_shader_barycentric,           EBhDisable },
+    { E_GL_NV_compute_shader_derivatives,            EBhDisable },
+    { E_GL_NV_shader_texture_footprint,              EBhDisable },
+    { E_GL_NV_mesh_shader,                           EBhDisable },
+
+    { E_GL_NV_cooperative_matrix,                    EBhDisable },
+    { E_GL_NV_shader_sm_builtins,                    EBhDisable },
+    { E_GL_NV_integer_cooperative_matrix,            EBhDisable },
 
     // AEP
-    extensionBehavior[E_GL_ANDROID_extension_pack_es31a]             = EBhDisable;
-    extensionBehavior[E_GL_KHR_blend_equation_advanced]              = EBhDisable;
-    extensionBehavior[E_GL_OES_sample_variables]                     = EBhDisable;
-    extensionBehavior[E_GL_OES_shader_image_atomic]                  = EBhDisable;
-    extensionBehavior[E_GL_OES_shader_multisample_interpolation]     = EBhDisable;
-    extensionBehavior[E_GL_OES_texture_storage_multisample_2d_array] = EBhDisable;
-    extensionBehavior[E_GL_EXT_geometry_shader]                      = EBhDisable;
-    extensionBehavior[E_GL_EXT_geometry_point_size]                  = EBhDisable;
-    extensionBehavior[E_GL_EXT_gpu_shader5]                          = EBhDisable;
-    extensionBehavior[E_GL_EXT_primitive_bounding_box]               = EBhDisable;
-    extensionBehavior[E_GL_EXT_shader_io_blocks]                     = EBhDisable;
-    extensionBehavior[E_GL_EXT_tessellation_shader]                  = EBhDisable;
-    extensionBehavior[E_GL_EXT_tessellation_point_size]              = EBhDisable;
-    extensionBehavior[E_GL_EXT_texture_buffer]                       = EBhDisable;
-    extensionBehavior[E_GL_EXT_texture_cube_map_array]               = EBhDisable;
+    { E_GL_ANDROID_extension_pack_es31a,             EBhDisable },
+    { E_GL_KHR_blend_equation_advanced,              EBhDisable },
+    { E_GL_OES_sample_variables,                     EBhDisable },
+    { E_GL_OES_shader_image_atomic,                  EBhDisable },
+    { E_GL_OES_shader_multisample_interpolation,     EBhDisable },
+    { E_GL_OES_texture_storage_multisample_2d_array, EBhDisable },
+    { E_GL_EXT_geometry_shader,                      EBhDisable },
+    { E_GL_EXT_geometry_point_size,                  EBhDisable },
+    { E_GL_EXT_gpu_shader5,                          EBhDisable },
+    { E_GL_EXT_primitive_bounding_box,               EBhDisable },
+    { E_GL_EXT_shader_io_blocks,                     EBhDisable },
+    { E_GL_EXT_tessellation_shader,                  EBhDisable },
+    { E_GL_EXT_tessellation_point_size,              EBhDisable },
+    { E_GL_EXT_texture_buffer,                       EBhDisable },
+    { E_GL_EXT_texture_cube_map_array,               EBhDisable },
 
     // OES matching AEP
-    extensionBehavior[E_GL_OES_geometry_shader]          = EBhDisable;
-    extensionBehavior[E_GL_OES_geometry_point_size]      = EBhDisable;
-    extensionBehavior[E_GL_OES_gpu_shader5]              = EBhDisable;
-    extensionBehavior[E_GL_OES_primitive_bounding_box]   = EBhDisable;
-    extensionBehavior[E_GL_OES_shader_io_blocks]         = EBhDisable;
-    extensionBehavior[E_GL_OES_tessellation_shader]      = EBhDisable;
-    extensionBehavior[E_GL_OES_tessellation_point_size]  = EBhDisable;
-    extensionBehavior[E_GL_OES_texture_buffer]           = EBhDisable;
-    extensionBehavior[E_GL_OES_texture_cube_map_array]   = EBhDisable;
-    extensionBehavior[E_GL_EXT_shader_integer_mix]       = EBhDisable;
+    { E_GL_OES_geometry_shader,          EBhDisable },
+    { E_GL_OES_geometry_point_size,      EBhDisable },
+    { E_GL_OES_gpu_shader5,              EBhDisable },
+    { E_GL_OES_primitive_bounding_box,   EBhDisable },
+    { E_GL_OES_shader_io_blocks,         EBhDisable },
+    { E_GL_OES_tessellation_shader,      EBhDisable },
+    { E_GL_OES_tessellation_point_size,  EBhDisable },
+    { E_GL_OES_texture_buffer,           EBhDisable },
+    { E_GL_OES_texture_cube_map_array,   EBhDisable },
+    { E_GL_EXT_shader_integer_mix,       EBhDisable },
 
     // EXT extensions
-    extensionBehavior[E_GL_EXT_device_group]                = EBhDisable;
-    extensionBehavior[E_GL_EXT_multiview]                   = EBhDisable;
-    extensionBehavior[E_GL_EXT_shader_realtime_clock]       = EBhDisable;
-    extensionBehavior[E_GL_EXT_ray_tracing]                 = EBhDisable;
-    extensionBehavior[E_GL_EXT_ray_query]                   = EBhDisable;
-    extensionBehavior[E_GL_EXT_ray_flags_primitive_culling] = EBhDisable;
-    extensionBehavior[E_GL_EXT_blend_func_extended]         = EBhDisable;
-    extensionBehavior[E_GL_EXT_shader_implicit_conversions] = EBhDisable;
+    { E_GL_EXT_device_group,                EBhDisable },
+    { E_GL_EXT_multiview,                   EBhDisable },
+    { E_GL_EXT_shader_realtime_clock,       EBhDisable },
+    { E_GL_EXT_ray_tracing,                 EBhDisable, EShTargetSpv_1_4 },
+    { E_GL_EXT_ray_query,                   EBhDisable },
+    { E_GL_EXT_ray_flags_primitive_culling, EBhDisable },
+    { E_GL_EXT_blend_func_extended,         EBhDisable },
+    { E_GL_EXT_shader_implicit_conversions, EBhDisable },
 
     // OVR extensions
-    extensionBehavior[E_GL_OVR_multiview]                = EBhDisable;
-    extensionBehavior[E_GL_OVR_multiview2]               = EBhDisable;
+    { E_GL_OVR_multiview,                EBhDisable },
+    { E_GL_OVR_multiview2,               EBhDisable },
 
     // explicit types
-    extensionBehavior[E_GL_EXT_shader_explicit_arithmetic_types]         = EBhDisable;
-    extensionBehavior[E_GL_EXT_shader_explicit_arithmetic_types_int8]    = EBhDisable;
-    extensionBehavior[E_GL_EXT_shader_explicit_arithmetic_types_int16]   = EBhDisable;
-    extensionBehavior[E_GL_EXT_shader_explicit_arithmetic_types_int32]   = EBhDisable;
-    extensionBehavior[E_GL_EXT_shader_explicit_arithmetic_types_int64]   = EBhDisable;
-    extensionBehavior[E_GL_EXT_shader_explicit_arithmetic_types_float16] = EBhDisable;
-    extensionBehavior[E_GL_EXT_shader_explicit_arithmetic_types_float32] = EBhDisable;
-    extensionBehavior[E_GL_EXT_shader_explicit_arithmetic_types_float64] = EBhDisable;
+    { E_GL_EXT_shader_explicit_arithmetic_types,         EBhDisable },
+    { E_GL_EXT_shader_explicit_arithmetic_types_int8,    EBhDisable },
+    { E_GL_EXT_shader_explicit_arithmetic_types_int16,   EBhDisable },
+    { E_GL_EXT_shader_explicit_arithmetic_types_int32,   EBhDisable },
+    { E_GL_EXT_shader_explicit_arithmetic_types_int64,   EBhDisable },
+    { E_GL_EXT_shader_explicit_arithmetic_types_float16, EBhDisable },
+    { E_GL_EXT_shader_explicit_arithmetic_types_float32, EBhDisable },
+    { E_GL_EXT_shader_explicit_arithmetic_types_float64, EBhDisable },
 
     // subgroup extended types
-    extensionBehavior[E_GL_EXT_shader_subgroup_extended_types_int8]    = EBhDisable;
-    extensionBehavior[E_GL_EXT_shader_subgroup_extended_types_int16]   = EBhDisable;
-    extensionBehavior[E_GL_EXT_shader_subgroup_extended_types_int64]   = EBhDisable;
-    extensionBehavior[E_GL_EXT_shader_subgroup_extended_types_float16] = EBhDisable;
+    { E_GL_EXT_shader_subgroup_extended_types_int8,    EBhDisable },
+    { E_GL_EXT_shader_subgroup_extended_types_int16,   EBhDisable },
+    { E_GL_EXT_shader_subgroup_extended_types_int64,   EBhDisable },
+    { E_GL_EXT_shader_subgroup_extended_types_float16, EBhDisable },
+};
+
+const int ExtensionCount = sizeof(Extensions) / sizeof(Extensions[0]);
+
+static_assert(ExtensionCount == EExtCount, "every extension id needs a row in Extensions[]");
+
+// Whether each row of Extensions[], from the given one on, sits at its extension's id.
+constexpr bool ExtensionIdsMatchRows(int row = 0)
+{
+    return row == ExtensionCount || (Extensions[row].extension.id == row && ExtensionIdsMatchRows(row + 1));
+}
+
+static_assert(ExtensionIdsMatchRows(), "Extensions[] must list the extensions in TExtensionId order");
+
+// Extension ids sorted by name, for looking up the names given to #extension.
+// After a single process-level initialization, this is read only and thread safe
+TExtensionId ExtensionsByName[ExtensionCount];
+
+// The initial behavior of each extension, by id, for each shader to start from
+TExtensionBehavior InitialExtensionBehavior[ExtensionCount];
+
+bool ExtensionTablesFilled = false;
+
+bool ExtensionNameLess(TExtensionId id, const char* name)
+{
+    return strcmp(Extensions[id].extension.name, name) < 0;
+}
+
+} // end anonymous namespace
+
+void TParseVersions::fillInExtensionMap()
+{
+    if (ExtensionTablesFilled) {
+        // this is really an error, as this should called only once per process
+        // but, the only risk is if two threads called simultaneously
+        return;
+    }
+    ExtensionTablesFilled = true;
+
+    for (int id = 0; id < ExtensionCount; ++id) {
+        ExtensionsByName[id] = (TExtensionId)id;
+        InitialExtensionBehavior[id] = Extensions[id].initialBehavior;
+    }
+    std::sort(ExtensionsByName, ExtensionsByName + ExtensionCount, [](TExtensionId left, TExtensionId right) {
+        return strcmp(Extensions[left].extension.name, Extensions[right].extension.name) < 0;
+    });
+}
+
+// Returns the known extension of the given name, or nullptr if there is none.
+const TExtension* FindExtension(const char* name)
+{
+    const TExtensionId* begin = ExtensionsByName;
+    const TExtensionId* end = begin + ExtensionCount;
+    const TExtensionId* id = std::lower_bound(begin, end, name, ExtensionNameLess);
+    if (id == end || strcmp(Extensions[*id].extension.name, name) != 0)
+        return nullptr;
+
+    return &Extensions[*id].extension;
+}
+
+//
+// Initialize all extensions to their initial behavior.
+//
+void TParseVersions::initializeExtensionBehavior()
+{
+    extensionBehavior.assign(InitialExtensionBehavior, InitialExtensionBehavior + ExtensionCount);
 }
 
 #endif // GLSLANG_WEB
@@ -658,7 +727,7 @@ void TParseVersions::requireProfile(const TSourceLoc& loc, int profileMask, cons
 
 // entry point that takes multiple extensions
 void TParseVersions::profileRequires(const TSourceLoc& loc, int profileMask, int minVersion, int numExtensions,
-    const char* const extensions[], const char* featureDesc)
+    const TExtension extensions[], const char* featureDesc)
 {
     if (profile & profileMask) {
         bool okay = minVersion > 0 && version >= minVersion;
@@ -682,10 +751,17 @@ void TParseVersions::profileRequires(const TSourceLoc& loc, int profileMask, int
 }
 
 // entry point for the above that takes a single extension
-void TParseVersions::profileRequires(const TSourceLoc& loc, int profileMask, int minVersion, const char* extension,
+void TParseVersions::profileRequires(const TSourceLoc& loc, int profileMask, int minVersion, TExtension extension,
+    const char* featureDesc)
+{
+    profileRequires(loc, profileMask, minVersion, 1, &extension, featureDesc);
+}
+
+// entry point for the above that takes no extension, for a feature only a version provides
+void TParseVersions::profileRequires(const TSourceLoc& loc, int profileMask, int minVersion, std::nullptr_t,
     const char* featureDesc)
 {
-    profileRequires(loc, profileMask, minVersion, extension ? 1 : 0, &extension, featureDesc);
+    profileRequires(loc, profileMask, minVersion, 0, nullptr, featureDesc);
 }
 
 void TParseVersions::unimplemented(const TSourceLoc& loc, const char* featureDesc)
@@ -728,7 +804,7 @@ void TParseVersions::requireNotRemoved(const TSourceLoc& loc, int profileMask, i
 
 // Returns true if at least one of the extensions in the extensions parameter is requested. Otherwise, returns false.
 // Warns appropriately if the requested behavior of an extension is "warn".
-bool TParseVersions::checkExtensionsRequested(const TSourceLoc& loc, int numExtensions, const char* const extensions[], const char* featureDesc)
+bool TParseVersions::checkExtensionsRequested(const TSourceLoc& loc, int numExtensions, const TExtension extensions[], const char* featureDesc)
 {
     // First, see if any of the extensions are enabled
     for (int i = 0; i < numExtensions; ++i) {
@@ -759,7 +835,7 @@ bool TParseVersions::checkExtensionsRequested(const TSourceLoc& loc, int numExte
 // Use when there are no profile/version to check, it's just an error if one of the
 // extensions is not present.
 //
-void TParseVersions::requireExtensions(const TSourceLoc& loc, int numExtensions, const char* const extensions[], const char* featureDesc)
+void TParseVersions::requireExtensions(const TSourceLoc& loc, int numExtensions, const TExtension extensions[], const char* featureDesc)
 {
     if (checkExtensionsRequested(loc, numExtensions, extensions, featureDesc))
         return;
@@ -778,7 +854,7 @@ void TParseVersions::requireExtensions(const TSourceLoc& loc, int numExtensions,
 // Use by preprocessor when there are no profile/version to check, it's just an error if one of the
 // extensions is not present.
 //
-void TParseVersions::ppRequireExtensions(const TSourceLoc& loc, int numExtensions, const char* const extensions[], const char* featureDesc)
+void TParseVersions::ppRequireExtensions(const TSourceLoc& loc, int numExtensions, const TExtension extensions[], const char* featureDesc)
 {
     if (checkExtensionsRequested(loc, numExtensions, extensions, featureDesc))
         return;
@@ -793,17 +869,13 @@ void TParseVersions::ppRequireExtensions(const TSourceLoc& loc, int numExtension
     }
 }
 
-TExtensionBehavior TParseVersions::getExtensionBehavior(const char* extension)
+TExtensionBehavior TParseVersions::getExtensionBehavior(TExtension extension)
 {
-    auto iter = extensionBehavior.find(TString(extension));
-    if (iter == extensionBehavior.end())
-        return EBhMissing;
-    else
-        return iter->second;
+    return extensionBehavior[extension.id];
 }
 
 // Returns true if the given extension is set to enable, require, or warn.
-bool TParseVersions::extensionTurnedOn(const char* const extension)
+bool TParseVersions::extensionTurnedOn(TExtension extension)
 {
       switch (getExtensionBehavior(extension)) {
       case EBhEnable:
@@ -816,7 +888,7 @@ bool TParseVersions::extensionTurnedOn(const char* const extension)
       return false;
 }
 // See if any of the extensions are set to enable, require, or warn.
-bool TParseVersions::extensionsTurnedOn(int numExtensions, const char* const extensions[])
+bool TParseVersions::extensionsTurnedOn(int numExtensions, const TExtension extensions[])
 {
     for (int i = 0; i < numExtensions; ++i) {
         if (extensionTurnedOn(extensions[i]))
@@ -925,12 +997,12 @@ void TParseVersions::updateExtensionBehavior(const char* extension, TExtensionBe
             return;
         } else {
             for (auto iter = extensionBehavior.begin(); iter != extensionBehavior.end(); ++iter)
-                iter->second = behavior;
+                *iter = behavior;
         }
     } else {
         // Do the update for this single extension
-        auto iter = extensionBehavior.find(TString(extension));
-        if (iter == extensionBehavior.end()) {
+        const TExtension* known = FindExtension(extension);
+        if (known == nullptr) {
             switch (behavior) {
             case EBhRequire:
                 error(getCurrentLoc(), "extension not supported:", "#extension", extension);
@@ -946,11 +1018,11 @@ void TParseVersions::updateExtensionBehavior(const char* extension, TExtensionBe
 
             return;
         } else {
-            if (iter->second == EBhDisablePartial)
+            if (extensionBehavior[known->id] == EBhDisablePartial)
                 warn(getCurrentLoc(), "extension is only partially supported:", "#extension", extension);
             if (behavior == EBhEnable || behavior == EBhRequire || behavior == EBhDisable)
                 intermediate.updateRequestedExtension(extension, behavior);
-            iter->second = behavior;
+            extensionBehavior[known->id] = behavior;
         }
     }
 }
@@ -978,9 +1050,9 @@ void TParseVersions::extensionRequires(const TSourceLoc &loc, const char * const
 
     if (isEnabled) {
         unsigned int minSpvVersion = 0;
-        auto iter = extensionMinSpv.find(TString(extension));
-        if (iter != extensionMinSpv.end())
-            minSpvVersion = iter->second;
+        const TExtension* known = FindExtension(extension);
+        if (known != nullptr)
+            minSpvVersion = Extensions[known->id].minSpvVersion;
         requireSpv(loc, extension, minSpvVersion);
     }
 }
@@ -998,7 +1070,7 @@ void TParseVersions::doubleCheck(const TSourceLoc& loc, const char* op)
 
     //requireProfile(loc, ECoreProfile | ECompatibilityProfile, op);
     if (language == EShLangVertex) {
-        const char* const f64_Extensions[] = {E_GL_ARB_gpu_shader_fp64, E_GL_ARB_vertex_attrib_64bit};
+        const TExtension f64_Extensions[] = {E_GL_ARB_gpu_shader_fp64, E_GL_ARB_vertex_attrib_64bit};
         profileRequires(loc, ECoreProfile | ECompatibilityProfile, 400, 2, f64_Extensions, op);
     } else
         profileRequires(loc, ECoreProfile | ECompatibilityProfile, 400, E_GL_ARB_gpu_shader_fp64, op);
@@ -1008,7 +1080,7 @@ void TParseVersions::doubleCheck(const TSourceLoc& loc, const char* op)
 void TParseVersions::float16Check(const TSourceLoc& loc, const char* op, bool builtIn)
 {
     if (!builtIn) {
-        const char* const extensions[] = {
+        const TExtension extensions[] = {
                                            E_GL_AMD_gpu_shader_half_float,
                                            E_GL_EXT_shader_explicit_arithmetic_types,
                                            E_GL_EXT_shader_explicit_arithmetic_types_float16};
@@ -1018,7 +1090,7 @@ void TParseVersions::float16Check(const TSourceLoc& loc, const char* op, bool bu
 
 bool TParseVersions::float16Arithmetic()
 {
-    const char* const extensions[] = {
+    const TExtension extensions[] = {
                                        E_GL_AMD_gpu_shader_half_float,
                                        E_GL_EXT_shader_explicit_arithmetic_types,
                                        E_GL_EXT_shader_explicit_arithmetic_types_float16};
@@ -1027,7 +1099,7 @@ bool TParseVersions::float16Arithmetic()
 
 bool TParseVersions::int16Arithmetic()
 {
-    const char* const extensions[] = {
+    const TExtension extensions[] = {
                                        E_GL_AMD_gpu_shader_int16,
                                        E_GL_EXT_shader_explicit_arithmetic_types,
                                        E_GL_EXT_shader_explicit_arithmetic_types_int16};
@@ -1036,7 +1108,7 @@ bool TParseVersions::int16Arithmetic()
 
 bool TParseVersions::int8Arithmetic()
 {
-    const char* const extensions[] = {
+    const TExtension extensions[] = {
                                        E_GL_EXT_shader_explicit_arithmetic_types,
                                        E_GL_EXT_shader_explicit_arithmetic_types_int8};
     return extensionsTurnedOn(sizeof(extensions)/sizeof(extensions[0]), extensions);
@@ -1049,7 +1121,7 @@ void TParseVersions::requireFloat16Arithmetic(const TSourceLoc& loc, const char*
     combined += ": ";
     combined += featureDesc;
 
-    const char* const extensions[] = {
+    const TExtension extensions[] = {
                                        E_GL_AMD_gpu_shader_half_float,
                                        E_GL_EXT_shader_explicit_arithmetic_types,
                                        E_GL_EXT_shader_explicit_arithmetic_types_float16};
@@ -1063,7 +1135,7 @@ void TParseVersions::requireInt16Arithmetic(const TSourceLoc& loc, const char* o
     combined += ": ";
     combined += featureDesc;
 
-    const char* const extensions[] = {
+    const TExtension extensions[] = {
                                        E_GL_AMD_gpu_shader_int16,
                                        E_GL_EXT_shader_explicit_arithmetic_types,
                                        E_GL_EXT_shader_explicit_arithmetic_types_int16};
@@ -1077,7 +1149,7 @@ void TParseVersions::requireInt8Arithmetic(const TSourceLoc& loc, const char* op
     combined += ": ";
     combined += featureDesc;
 
-    const char* const extensions[] = {
+    const TExtension extensions[] = {
                                        E_GL_EXT_shader_explicit_arithmetic_types,
                                        E_GL_EXT_shader_explicit_arithmetic_types_int8};
     requireExtensions(loc, sizeof(extensions)/sizeof(extensions[0]), extensions, combined.c_str());
@@ -1086,7 +1158,7 @@ void TParseVersions::requireInt8Arithmetic(const TSourceLoc& loc, const char* op
 void TParseVersions::float16ScalarVectorCheck(const TSourceLoc& loc, const char* op, bool builtIn)
 {
     if (!builtIn) {
-        const char* const extensions[] = {
+        const TExtension extensions[] = {
                                            E_GL_AMD_gpu_shader_half_float,
                                            E_GL_EXT_shader_16bit_storage,
                                            E_GL_EXT_shader_explicit_arithmetic_types,
@@ -1099,7 +1171,7 @@ void TParseVersions::float16ScalarVectorCheck(const TSourceLoc& loc, const char*
 void TParseVersions::explicitFloat32Check(const TSourceLoc& loc, const char* op, bool builtIn)
 {
     if (!builtIn) {
-        const char* const extensions[2] = {E_GL_EXT_shader_explicit_arithmetic_types,
+        const TExtension extensions[2] = {E_GL_EXT_shader_explicit_arithmetic_types,
                                            E_GL_EXT_shader_explicit_arithmetic_types_float32};
         requireExtensions(loc, 2, extensions, op);
     }
@@ -1109,7 +1181,7 @@ void TParseVersions::explicitFloat32Check(const TSourceLoc& loc, const char* op,
 void TParseVersions::explicitFloat64Check(const TSourceLoc& loc, const char* op, bool builtIn)
 {
     if (!builtIn) {
-        const char* const extensions[2] = {E_GL_EXT_shader_explicit_arithmetic_types,
+        const TExtension extensions[2] = {E_GL_EXT_shader_explicit_arithmetic_types,
                                            E_GL_EXT_shader_explicit_arithmetic_types_float64};
         requireExtensions(loc, 2, extensions, op);
         requireProfile(loc, ECoreProfile | ECompatibilityProfile, op);
@@ -1121,7 +1193,7 @@ void TParseVersions::explicitFloat64Check(const TSourceLoc& loc, const char* op,
 void TParseVersions::explicitInt8Check(const TSourceLoc& loc, const char* op, bool builtIn)
 {
     if (! builtIn) {
-        const char* const extensions[2] = {E_GL_EXT_shader_explicit_arithmetic_types,
+        const TExtension extensions[2] = {E_GL_EXT_shader_explicit_arithmetic_types,
                                            E_GL_EXT_shader_explicit_arithmetic_types_int8};
         requireExtensions(loc, 2, extensions, op);
     }
@@ -1141,7 +1213,7 @@ void TParseVersions::float16OpaqueCheck(const TSourceLoc& loc, const char* op, b
 void TParseVersions::explicitInt16Check(const TSourceLoc& loc, const char* op, bool builtIn)
 {
     if (! builtIn) {
-        const char* const extensions[] = {
+        const TExtension extensions[] = {
                                            E_GL_AMD_gpu_shader_int16,
                                            E_GL_EXT_shader_explicit_arithmetic_types,
                                            E_GL_EXT_shader_explicit_arithmetic_types_int16};
@@ -1152,7 +1224,7 @@ void TParseVersions::explicitInt16Check(const TSourceLoc& loc, const char* op, b
 void TParseVersions::int16ScalarVectorCheck(const TSourceLoc& loc, const char* op, bool builtIn)
 {
     if (! builtIn) {
-    	const char* const extensions[] = {
+    	const TExtension extensions[] = {
                                            E_GL_AMD_gpu_shader_int16,
                                            E_GL_EXT_shader_16bit_storage,
                                            E_GL_EXT_shader_explicit_arithmetic_types,
@@ -1164,7 +1236,7 @@ void TParseVersions::int16ScalarVectorCheck(const TSourceLoc& loc, const char* o
 void TParseVersions::int8ScalarVectorCheck(const TSourceLoc& loc, const char* op, bool builtIn)
 {
     if (! builtIn) {
-    	const char* const extensions[] = {
+    	const TExtension extensions[] = {
                                            E_GL_EXT_shader_8bit_storage,
                                            E_GL_EXT_shader_explicit_arithmetic_types,
                                            E_GL_EXT_shader_explicit_arithmetic_types_int8};
@@ -1176,7 +1248,7 @@ void TParseVersions::int8ScalarVectorCheck(const TSourceLoc& loc, const char* op
 void TParseVersions::explicitInt32Check(const TSourceLoc& loc, const char* op, bool builtIn)
 {
     if (! builtIn) {
-        const char* const extensions[2] = {E_GL_EXT_shader_explicit_arithmetic_types,
+        const TExtension extensions[2] = {E_GL_EXT_shader_explicit_arithmetic_types,
                                            E_GL_EXT_shader_explicit_arithmetic_types_int32};
         requireExtensions(loc, 2, extensions, op);
     }
@@ -1186,7 +1258,7 @@ void TParseVersions::explicitInt32Check(const TSourceLoc& loc, const char* op, b
 void TParseVersions::int64Check(const TSourceLoc& loc, const char* op, bool builtIn)
 {
     if (! builtIn) {
-        const char* const extensions[3] = {E_GL_ARB_gpu_shader_int64,
+        const TExtension extensions[3] = {E_GL_ARB_gpu_shader_int64,
                                            E_GL_EXT_shader_explicit_arithmetic_types,
                                            E_GL_EXT_shader_explicit_arithmetic_types_int64};
         requireExtensions(loc, 3, extensions, op);
@@ -1198,7 +1270,7 @@ void TParseVersions::int64Check(const TSourceLoc& loc, const char* op, bool buil
 void TParseVersions::fcoopmatCheck(const TSourceLoc& loc, const char* op, bool builtIn)
 {
     if (!builtIn) {
-        const char* const extensions[] = {E_GL_NV_cooperative_matrix};
+        const TExtension extensions[] = {E_GL_NV_cooperative_matrix};
         requireExtensions(loc, sizeof(extensions)/sizeof(extensions[0]), extensions, op);
     }
 }
@@ -1206,7 +1278,7 @@ void TParseVersions::fcoopmatCheck(const TSourceLoc& loc, const char* op, bool b
 void TParseVersions::intcoopmatCheck(const TSourceLoc& loc, const char* op, bool builtIn)
 {
     if (!builtIn) {
-        const char* const extensions[] = {E_GL_NV_integer_cooperative_matrix};
+        const TExtension extensions[] = {E_GL_NV_integer_cooperative_matrix};
         requireExtensions(loc, sizeof(extensions)/sizeof(extensions[0]), extensions, op);
     }
 }
@@ -107,224 +107,420 @@ typedef enum {
 } TExtensionBehavior;
 
 //
-// Symbolic names for extensions.  Strings may be directly used when calling the
-// functions, but better to have the compiler do spelling checks.
+// Each extension known at build time has an id: its position in this list, which
+// is also its row in the table of extensions in Versions.cpp.  Checks through the
+// id index a shader's extension state directly, without looking up the name.
 //
-const char* const E_GL_OES_texture_3D                   = "GL_OES_texture_3D";
-const char* const E_GL_OES_standard_derivatives         = "GL_OES_standard_derivatives";
-const char* const E_GL_EXT_frag_depth                   = "GL_EXT_frag_depth";
-const char* const E_GL_OES_EGL_image_external           = "GL_OES_EGL_image_external";
-const char* const E_GL_OES_EGL_image_external_essl3     = "GL_OES_EGL_image_external_essl3";
-const char* const E_GL_EXT_YUV_target                   = "GL_EXT_YUV_target";
-const char* const E_GL_EXT_shader_texture_lod           = "GL_EXT_shader_texture_lod";
-const char* const E_GL_EXT_shadow_samplers              = "GL_EXT_shadow_samplers";
-
-const char* const E_GL_ARB_texture_rectangle            = "GL_ARB_texture_rectangle";
-const char* const E_GL_3DL_array_objects                = "GL_3DL_array_objects";
-const char* const E_GL_ARB_shading_language_420pack     = "GL_ARB_shading_language_420pack";
-const char* const E_GL_ARB_texture_gather               = "GL_ARB_texture_gather";
-const char* const E_GL_ARB_gpu_shader5                  = "GL_ARB_gpu_shader5";
-const char* const E_GL_ARB_separate_shader_objects      = "GL_ARB_separate_shader_objects";
-const char* const E_GL_ARB_compute_shader               = "GL_ARB_compute_shader";
-const char* const E_GL_ARB_tessellation_shader          = "GL_ARB_tessellation_shader";
-const char* const E_GL_ARB_enhanced_layouts             = "GL_ARB_enhanced_layouts";
-const char* const E_GL_ARB_texture_cube_map_array       = "GL_ARB_texture_cube_map_array";
-const char* const E_GL_ARB_texture_multisample          = "GL_ARB_texture_multisample";
-const char* const E_GL_ARB_shader_texture_lod           = "GL_ARB_shader_texture_lod";
-const char* const E_GL_ARB_explicit_attrib_location     = "GL_ARB_explicit_attrib_location";
-const char* const E_GL_ARB_explicit_uniform_location    = "GL_ARB_explicit_uniform_location";
-const char* const E_GL_ARB_shader_image_load_store      = "GL_ARB_shader_image_load_store";
-const char* const E_GL_ARB_shader_atomic_counters       = "GL_ARB_shader_atomic_counters";
-const char* const E_GL_ARB_shader_draw_parameters       = "GL_ARB_shader_draw_parameters";
-const char* const E_GL_ARB_shader_group_vote            = "GL_ARB_shader_group_vote";
-const char* const E_GL_ARB_derivative_control           = "GL_ARB_derivative_control";
-const char* const E_GL_ARB_shader_texture_image_samples = "GL_ARB_shader_texture_image_samples";
-const char* const E_GL_ARB_viewport_array               = "GL_ARB_viewport_array";
-const char* const E_GL_ARB_gpu_shader_int64             = "GL_ARB_gpu_shader_int64";
-const char* const E_GL_ARB_gpu_shader_fp64              = "GL_ARB_gpu_shader_fp64";
-const char* const E_GL_ARB_shader_ballot                = "GL_ARB_shader_ballot";
-const char* const E_GL_ARB_sparse_texture2              = "GL_ARB_sparse_texture2";
-const char* const E_GL_ARB_sparse_texture_clamp         = "GL_ARB_sparse_texture_clamp";
-const char* const E_GL_ARB_shader_stencil_export        = "GL_ARB_shader_stencil_export";
+enum TExtensionId {
+    EExt_GL_OES_texture_3D,
+    EExt_GL_OES_standard_derivatives,
+    EExt_GL_EXT_frag_depth,
+    EExt_GL_OES_EGL_image_external,
+    EExt_GL_OES_EGL_image_external_essl3,
+    EExt_GL_EXT_YUV_target,
+    EExt_GL_EXT_shader_texture_lod,
+    EExt_GL_EXT_shadow_samplers,
+    EExt_GL_ARB_texture_rectangle,
+    EExt_GL_3DL_array_objects,
+    EExt_GL_ARB_shading_language_420pack,
+    EExt_GL_ARB_texture_gather,
+    EExt_GL_ARB_gpu_shader5,
+    EExt_GL_ARB_separate_shader_objects,
+    EExt_GL_ARB_compute_shader,
+    EExt_GL_ARB_tessellation_shader,
+    EExt_GL_ARB_enhanced_layouts,
+    EExt_GL_ARB_texture_cube_map_array,
+    EExt_GL_ARB_texture_multisample,
+    EExt_GL_ARB_shader_texture_lod,
+    EExt_GL_ARB_explicit_attrib_location,
+    EExt_GL_ARB_explicit_uniform_location,
+    EExt_GL_ARB_shader_image_load_store,
+    EExt_GL_ARB_shader_atomic_counters,
+    EExt_GL_ARB_shader_draw_parameters,
+    EExt_GL_ARB_shader_group_vote,
+    EExt_GL_ARB_derivative_control,
+    EExt_GL_ARB_shader_texture_image_samples,
+    EExt_GL_ARB_viewport_array,
+    EExt_GL_ARB_gpu_shader_int64,
+    EExt_GL_ARB_gpu_shader_fp64,
+    EExt_GL_ARB_shader_ballot,
+    EExt_GL_ARB_sparse_texture2,
+    EExt_GL_ARB_sparse_texture_clamp,
+    EExt_GL_ARB_shader_stencil_export,
+    EExt_GL_ARB_post_depth_coverage,
+    EExt_GL_ARB_shader_viewport_layer_array,
+    EExt_GL_ARB_fragment_shader_interlock,
+    EExt_GL_ARB_shader_clock,
+    EExt_GL_ARB_uniform_buffer_object,
+    EExt_GL_ARB_sample_shading,
+    EExt_GL_ARB_shader_bit_encoding,
+    EExt_GL_ARB_shader_image_size,
+    EExt_GL_ARB_shader_storage_buffer_object,
+    EExt_GL_ARB_shading_language_packing,
+    EExt_GL_ARB_texture_query_lod,
+    EExt_GL_ARB_vertex_attrib_64bit,
+
+    EExt_GL_KHR_shader_subgroup_basic,
+    EExt_GL_KHR_shader_subgroup_vote,
+    EExt_GL_KHR_shader_subgroup_arithmetic,
+    EExt_GL_KHR_shader_subgroup_ballot,
+    EExt_GL_KHR_shader_subgroup_shuffle,
+    EExt_GL_KHR_shader_subgroup_shuffle_relative,
+    EExt_GL_KHR_shader_subgroup_clustered,
+    EExt_GL_KHR_shader_subgroup_quad,
+    EExt_GL_KHR_memory_scope_semantics,
+
+    EExt_GL_EXT_shader_atomic_int64,
+
+    EExt_GL_EXT_shader_non_constant_global_initializers,
+    EExt_GL_EXT_shader_image_load_formatted,
+    EExt_GL_EXT_post_depth_coverage,
+    EExt_GL_EXT_control_flow_attributes,
+    EExt_GL_EXT_nonuniform_qualifier,
+    EExt_GL_EXT_samplerless_texture_functions,
+    EExt_GL_EXT_scalar_block_layout,
+    EExt_GL_EXT_fragment_invocation_density,
+    EExt_GL_EXT_buffer_reference,
+    EExt_GL_EXT_buffer_reference2,
+    EExt_GL_EXT_buffer_reference_uvec2,
+    EExt_GL_EXT_demote_to_helper_invocation,
+    EExt_GL_EXT_debug_printf,
+
+    EExt_GL_EXT_shader_16bit_storage,
+    EExt_GL_EXT_shader_8bit_storage,
+
+    // #line and #include
+    EExt_GL_GOOGLE_cpp_style_line_directive,
+    EExt_GL_GOOGLE_include_directive,
+
+    EExt_GL_AMD_shader_ballot,
+    EExt_GL_AMD_shader_trinary_minmax,
+    EExt_GL_AMD_shader_explicit_vertex_parameter,
+    EExt_GL_AMD_gcn_shader,
+    EExt_GL_AMD_gpu_shader_half_float,
+    EExt_GL_AMD_texture_gather_bias_lod,
+    EExt_GL_AMD_gpu_shader_int16,
+    EExt_GL_AMD_shader_image_load_store_lod,
+    EExt_GL_AMD_shader_fragment_mask,
+    EExt_GL_AMD_gpu_shader_half_float_fetch,
+
+    EExt_GL_INTEL_shader_integer_functions2,
+
+    EExt_GL_NV_sample_mask_override_coverage,
+    EExt_SPV_NV_geometry_shader_passthrough,
+    EExt_GL_NV_viewport_array2,
+    EExt_GL_NV_stereo_view_rendering,
+    EExt_GL_NVX_multiview_per_view_attributes,
+    EExt_GL_NV_shader_atomic_int64,
+    EExt_GL_NV_conservative_raster_underestimation,
+    EExt_GL_NV_shader_noperspective_interpolation,
+    EExt_GL_NV_shader_subgroup_partitioned,
+    EExt_GL_NV_shading_rate_image,
+    EExt_GL_NV_ray_tracing,
+    EExt_GL_NV_fragment_shader_barycentric,
+    EExt_GL_NV_compute_shader_derivatives,
+    EExt_GL_NV_shader_texture_footprint,
+    EExt_GL_NV_mesh_shader,
+
+    EExt_GL_NV_cooperative_matrix,
+    EExt_GL_NV_shader_sm_builtins,
+    EExt_GL_NV_integer_cooperative_matrix,
+
+    // AEP
+    EExt_GL_ANDROID_extension_pack_es31a,
+    EExt_GL_KHR_blend_equation_advanced,
+    EExt_GL_OES_sample_variables,
+    EExt_GL_OES_shader_image_atomic,
+    EExt_GL_OES_shader_multisample_interpolation,
+    EExt_GL_OES_texture_storage_multisample_2d_array,
+    EExt_GL_EXT_geometry_shader,
+    EExt_GL_EXT_geometry_point_size,
+    EExt_GL_EXT_gpu_shader5,
+    EExt_GL_EXT_primitive_bounding_box,
+    EExt_GL_EXT_shader_io_blocks,
+    EExt_GL_EXT_tessellation_shader,
+    EExt_GL_EXT_tessellation_point_size,
+    EExt_GL_EXT_texture_buffer,
+    EExt_GL_EXT_texture_cube_map_array,
+
+    // OES matching AEP
+    EExt_GL_OES_geometry_shader,
+    EExt_GL_OES_geometry_point_size,
+    EExt_GL_OES_gpu_shader5,
+    EExt_GL_OES_primitive_bounding_box,
+    EExt_GL_OES_shader_io_blocks,
+    EExt_GL_OES_tessellation_shader,
+    EExt_GL_OES_tessellation_point_size,
+    EExt_GL_OES_texture_buffer,
+    EExt_GL_OES_texture_cube_map_array,
+    EExt_GL_EXT_shader_integer_mix,
+
+    // EXT extensions
+    EExt_GL_EXT_device_group,
+    EExt_GL_EXT_multiview,
+    EExt_GL_EXT_shader_realtime_clock,
+    EExt_GL_EXT_ray_tracing,
+    EExt_GL_EXT_ray_query,
+    EExt_GL_EXT_ray_flags_primitive_culling,
+    EExt_GL_EXT_blend_func_extended,
+    EExt_GL_EXT_shader_implicit_conversions,
+
+    // OVR extensions
+    EExt_GL_OVR_multiview,
+    EExt_GL_OVR_multiview2,
+
+    // explicit types
+    EExt_GL_EXT_shader_explicit_arithmetic_types,
+    EExt_GL_EXT_shader_explicit_arithmetic_types_int8,
+    EExt_GL_EXT_shader_explicit_arithmetic_types_int16,
+    EExt_GL_EXT_shader_explicit_arithmetic_types_int32,
+    EExt_GL_EXT_shader_explicit_arithmetic_types_int64,
+    EExt_GL_EXT_shader_explicit_arithmetic_types_float16,
+    EExt_GL_EXT_shader_explicit_arithmetic_types_float32,
+    EExt_GL_EXT_shader_explicit_arithmetic_types_float64,
+
+    // subgroup extended types
+    EExt_GL_EXT_shader_subgroup_extended_types_int8,
+    EExt_GL_EXT_shader_subgroup_extended_types_int16,
+    EExt_GL_EXT_shader_subgroup_extended_types_int64,
+    EExt_GL_EXT_shader_subgroup_extended_types_float16,
+
+    EExtCount
+};
+
+//
+// An extension known at build time, with its name and its id.  It converts to its
+// name wherever a name is wanted.
+//
+struct TExtension {
+    constexpr operator const char*() const { return name; }
+
+    const char* name;
+    TExtensionId id;
+};
+
+// Returns the known extension of the given name, or nullptr if there is none.
+const TExtension* FindExtension(const char* name);
+
+//
+// Symbolic names for extensions, so the compiler does spelling checks, and each
+// carries its id.
+//
+constexpr TExtension E_GL_OES_texture_3D                   = { "GL_OES_texture_3D", EExt_GL_OES_texture_3D };
+constexpr TExtension E_GL_OES_standard_derivatives         = { "GL_OES_standard_derivatives", EExt_GL_OES_standard_derivatives };
+constexpr TExtension E_GL_EXT_frag_depth                   = { "GL_EXT_frag_depth", EExt_GL_EXT_frag_depth };
+constexpr TExtension E_GL_OES_EGL_image_external           = { "GL_OES_EGL_image_external", EExt_GL_OES_EGL_image_external };
+constexpr TExtension E_GL_OES_EGL_image_external_essl3     = { "GL_OES_EGL_image_external_essl3", EExt_GL_OES_EGL_image_external_essl3 };
+constexpr TExtension E_GL_EXT_YUV_target                   = { "GL_EXT_YUV_target", EExt_GL_EXT_YUV_target };
+constexpr TExtension E_GL_EXT_shader_texture_lod           = { "GL_EXT_shader_texture_lod", EExt_GL_EXT_shader_texture_lod };
+constexpr TExtension E_GL_EXT_shadow_samplers              = { "GL_EXT_shadow_samplers", EExt_GL_EXT_shadow_samplers };
+
+constexpr TExtension E_GL_ARB_texture_rectangle            = { "GL_ARB_texture_rectangle", EExt_GL_ARB_texture_rectangle };
+constexpr TExtension E_GL_3DL_array_objects                = { "GL_3DL_array_objects", EExt_GL_3DL_array_objects };
+constexpr TExtension E_GL_ARB_shading_language_420pack     = { "GL_ARB_shading_language_420pack", EExt_GL_ARB_shading_language_420pack };
+constexpr TExtension E_GL_ARB_texture_gather               = { "GL_ARB_texture_gather", EExt_GL_ARB_texture_gather };
+constexpr TExtension E_GL_ARB_gpu_shader5                  = { "GL_ARB_gpu_shader5", EExt_GL_ARB_gpu_shader5 };
+constexpr TExtension E_GL_ARB_separate_shader_objects      = { "GL_ARB_separate_shader_objects", EExt_GL_ARB_separate_shader_objects };
+constexpr TExtension E_GL_ARB_compute_shader               = { "GL_ARB_compute_shader", EExt_GL_ARB_compute_shader };
+constexpr TExtension E_GL_ARB_tessellation_shader          = { "GL_ARB_tessellation_shader", EExt_GL_ARB_tessellation_shader };
+constexpr TExtension E_GL_ARB_enhanced_layouts             = { "GL_ARB_enhanced_layouts", EExt_GL_ARB_enhanced_layouts };
+constexpr TExtension E_GL_ARB_texture_cube_map_array       = { "GL_ARB_texture_cube_map_array", EExt_GL_ARB_texture_cube_map_array };
+constexpr TExtension E_GL_ARB_texture_multisample          = { "GL_ARB_texture_multisample", EExt_GL_ARB_texture_multisample };
+constexpr TExtension E_GL_ARB_shader_texture_lod           = { "GL_ARB_shader_texture_lod", EExt_GL_ARB_shader_texture_lod };
+constexpr TExtension E_GL_ARB_explicit_attrib_location     = { "GL_ARB_explicit_attrib_location", EExt_GL_ARB_explicit_attrib_location };
+constexpr TExtension E_GL_ARB_explicit_uniform_location    = { "GL_ARB_explicit_uniform_location", EExt_GL_ARB_explicit_uniform_location };
+constexpr TExtension E_GL_ARB_shader_image_load_store      = { "GL_ARB_shader_image_load_store", EExt_GL_ARB_shader_image_load_store };
+constexpr TExtension E_GL_ARB_shader_atomic_counters       = { "GL_ARB_shader_atomic_counters", EExt_GL_ARB_shader_atomic_counters };
+constexpr TExtension E_GL_ARB_shader_draw_parameters       = { "GL_ARB_shader_draw_parameters", EExt_GL_ARB_shader_draw_parameters };
+constexpr TExtension E_GL_ARB_shader_group_vote            = { "GL_ARB_shader_group_vote", EExt_GL_ARB_shader_group_vote };
+constexpr TExtension E_GL_ARB_derivative_control           = { "GL_ARB_derivative_control", EExt_GL_ARB_derivative_control };
+constexpr TExtension E_GL_ARB_shader_texture_image_samples = { "GL_ARB_shader_texture_image_samples", EExt_GL_ARB_shader_texture_image_samples };
+constexpr TExtension E_GL_ARB_viewport_array               = { "GL_ARB_viewport_array", EExt_GL_ARB_viewport_array };
+constexpr TExtension E_GL_ARB_gpu_shader_int64             = { "GL_ARB_gpu_shader_int64", EExt_GL_ARB_gpu_shader_int64 };
+constexpr TExtension E_GL_ARB_gpu_shader_fp64              = { "GL_ARB_gpu_shader_fp64", EExt_GL_ARB_gpu_shader_fp64 };
+constexpr TExtension E_GL_ARB_shader_ballot                = { "GL_ARB_shader_ballot", EExt_GL_ARB_shader_ballot };
+constexpr TExtension E_GL_ARB_sparse_texture2              = { "GL_ARB_sparse_texture2", EExt_GL_ARB_sparse_texture2 };
+constexpr TExtension E_GL_ARB_sparse_texture_clamp         = { "GL_ARB_sparse_texture_clamp", EExt_GL_ARB_sparse_texture_clamp };
+constexpr TExtension E_GL_ARB_shader_stencil_export        = { "GL_ARB_shader_stencil_export", EExt_GL_ARB_shader_stencil_export };
 // const char* const E_GL_ARB_cull_distance            = "GL_ARB_cull_distance";  // present for 4.5, but need extension control over block members
-const char* const E_GL_ARB_post_depth_coverage          = "GL_ARB_post_depth_coverage";
-const char* const E_GL_ARB_shader_viewport_layer_array  = "GL_ARB_shader_viewport_layer_array";
-const char* const E_GL_ARB_fragment_shader_interlock    = "GL_ARB_fragment_shader_interlock";
-const char* const E_GL_ARB_shader_clock                 = "GL_ARB_shader_clock";
-const char* const E_GL_ARB_uniform_buffer_object        = "GL_ARB_uniform_buffer_object";
-const char* const E_GL_ARB_sample_shading               = "GL_ARB_sample_shading";
-const char* const E_GL_ARB_shader_bit_encoding          = "GL_ARB_shader_bit_encoding";
-const char* const E_GL_ARB_shader_image_size            = "GL_ARB_shader_image_size";
-const char* const E_GL_ARB_shader_storage_buffer_object = "GL_ARB_shader_storage_buffer_object";
-const char* const E_GL_ARB_shading_language_packing     = "GL_ARB_shading_language_packing";
-const char* const E_GL_ARB_texture_query_lod            = "GL_ARB_texture_query_lod";
-const char* const E_GL_ARB_vertex_attrib_64bit          = "GL_ARB_vertex_attrib_64bit";
-
-const char* const E_GL_KHR_shader_subgroup_basic            = "GL_KHR_shader_subgroup_basic";
-const char* const E_GL_KHR_shader_subgroup_vote             = "GL_KHR_shader_subgroup_vote";
-const char* const E_GL_KHR_shader_subgroup_arithmetic       = "GL_KHR_shader_subgroup_arithmetic";
-const char* const E_GL_KHR_shader_subgroup_ballot           = "GL_KHR_shader_subgroup_ballot";
-const char* const E_GL_KHR_shader_subgroup_shuffle          = "GL_KHR_shader_subgroup_shuffle";
-const char* const E_GL_KHR_shader_subgroup_shuffle_relative = "GL_KHR_shader_subgroup_shuffle_relative";
-const char* const E_GL_KHR_shader_subgroup_clustered        = "GL_KHR_shader_subgroup_clustered";
-const char* const E_GL_KHR_shader_subgroup_quad             = "GL_KHR_shader_subgroup_quad";
-const char* const E_GL_KHR_memory_scope_semantics           = "GL_KHR_memory_scope_semantics";
-
-const char* const E_GL_EXT_shader_atomic_int64              = "GL_EXT_shader_atomic_int64";
-
-const char* const E_GL_EXT_shader_non_constant_global_initializers = "GL_EXT_shader_non_constant_global_initializers";
-const char* const E_GL_EXT_shader_image_load_formatted = "GL_EXT_shader_image_load_formatted";
-
-const char* const E_GL_EXT_shader_16bit_storage             = "GL_EXT_shader_16bit_storage";
-const char* const E_GL_EXT_shader_8bit_storage              = "GL_EXT_shader_8bit_storage";
+constexpr TExtension E_GL_ARB_post_depth_coverage          = { "GL_ARB_post_depth_coverage", EExt_GL_ARB_post_depth_coverage };
+constexpr TExtension E_GL_ARB_shader_viewport_layer_array  = { "GL_ARB_shader_viewport_layer_array", EExt_GL_ARB_shader_viewport_layer_array };
+constexpr TExtension E_GL_ARB_fragment_shader_interlock    = { "GL_ARB_fragment_shader_interlock", EExt_GL_ARB_fragment_shader_interlock };
+constexpr TExtension E_GL_ARB_shader_clock                 = { "GL_ARB_shader_clock", EExt_GL_ARB_shader_clock };
+constexpr TExtension E_GL_ARB_uniform_buffer_object        = { "GL_ARB_uniform_buffer_object", EExt_GL_ARB_uniform_buffer_object };
+constexpr TExtension E_GL_ARB_sample_shading               = { "GL_ARB_sample_shading", EExt_GL_ARB_sample_shading };
+constexpr TExtension E_GL_ARB_shader_bit_encoding          = { "GL_ARB_shader_bit_encoding", EExt_GL_ARB_shader_bit_encoding };
+constexpr TExtension E_GL_ARB_shader_image_size            = { "GL_ARB_shader_image_size", EExt_GL_ARB_shader_image_size };
+constexpr TExtension E_GL_ARB_shader_storage_buffer_object = { "GL_ARB_shader_storage_buffer_object", EExt_GL_ARB_shader_storage_buffer_object };
+constexpr TExtension E_GL_ARB_shading_language_packing     = { "GL_ARB_shading_language_packing", EExt_GL_ARB_shading_language_packing };
+constexpr TExtension E_GL_ARB_texture_query_lod            = { "GL_ARB_texture_query_lod", EExt_GL_ARB_texture_query_lod };
+constexpr TExtension E_GL_ARB_vertex_attrib_64bit          = { "GL_ARB_vertex_attrib_64bit", EExt_GL_ARB_vertex_attrib_64bit };
+
+constexpr TExtension E_GL_KHR_shader_subgroup_basic            = { "GL_KHR_shader_subgroup_basic", EExt_GL_KHR_shader_subgroup_basic };
+constexpr TExtension E_GL_KHR_shader_subgroup_vote             = { "GL_KHR_shader_subgroup_vote", EExt_GL_KHR_shader_subgroup_vote };
+constexpr TExtension E_GL_KHR_shader_subgroup_arithmetic       = { "GL_KHR_shader_subgroup_arithmetic", EExt_GL_KHR_shader_subgroup_arithmetic };
+constexpr TExtension E_GL_KHR_shader_subgroup_ballot           = { "GL_KHR_shader_subgroup_ballot", EExt_GL_KHR_shader_subgroup_ballot };
+constexpr TExtension E_GL_KHR_shader_subgroup_shuffle          = { "GL_KHR_shader_subgroup_shuffle", EExt_GL_KHR_shader_subgroup_shuffle };
+constexpr TExtension E_GL_KHR_shader_subgroup_shuffle_relative = { "GL_KHR_shader_subgroup_shuffle_relative", EExt_GL_KHR_shader_subgroup_shuffle_relative };
+constexpr TExtension E_GL_KHR_shader_subgroup_clustered        = { "GL_KHR_shader_subgroup_clustered", EExt_GL_KHR_shader_subgroup_clustered };
+constexpr TExtension E_GL_KHR_shader_subgroup_quad             = { "GL_KHR_shader_subgroup_quad", EExt_GL_KHR_shader_subgroup_quad };
+constexpr TExtension E_GL_KHR_memory_scope_semantics           = { "GL_KHR_memory_scope_semantics", EExt_GL_KHR_memory_scope_semantics };
+
+constexpr TExtension E_GL_EXT_shader_atomic_int64              = { "GL_EXT_shader_atomic_int64", EExt_GL_EXT_shader_atomic_int64 };
+
+constexpr TExtension E_GL_EXT_shader_non_constant_global_initializers = { "GL_EXT_shader_non_constant_global_initializers", EExt_GL_EXT_shader_non_constant_global_initializers };
+constexpr TExtension E_GL_EXT_shader_image_load_formatted = { "GL_EXT_shader_image_load_formatted", EExt_GL_EXT_shader_image_load_formatted };
+
+constexpr TExtension E_GL_EXT_shader_16bit_storage             = { "GL_EXT_shader_16bit_storage", EExt_GL_EXT_shader_16bit_storage };
+constexpr TExtension E_GL_EXT_shader_8bit_storage              = { "GL_EXT_shader_8bit_storage", EExt_GL_EXT_shader_8bit_storage };
 
 
 // EXT extensions
-const char* const E_GL_EXT_device_group                     = "GL_EXT_device_group";
-const char* const E_GL_EXT_multiview                        = "GL_EXT_multiview";
-const char* const E_GL_EXT_post_depth_coverage              = "GL_EXT_post_depth_coverage";
-const char* const E_GL_EXT_control_flow_attributes          = "GL_EXT_control_flow_attributes";
-const char* const E_GL_EXT_nonuniform_qualifier             = "GL_EXT_nonuniform_qualifier";
-const char* const E_GL_EXT_samplerless_texture_functions    = "GL_EXT_samplerless_texture_functions";
-const char* const E_GL_EXT_scalar_block_layout              = "GL_EXT_scalar_block_layout";
-const char* const E_GL_EXT_fragment_invocation_density      = "GL_EXT_fragment_invocation_density";
-const char* const E_GL_EXT_buffer_reference                 = "GL_EXT_buffer_reference";
-const char* const E_GL_EXT_buffer_reference2                = "GL_EXT_buffer_reference2";
-const char* const E_GL_EXT_buffer_reference_uvec2           = "GL_EXT_buffer_reference_uvec2";
-const char* const E_GL_EXT_demote_to_helper_invocation      = "GL_EXT_demote_to_helper_invocation";
-const char* const E_GL_EXT_shader_realtime_clock            = "GL_EXT_shader_realtime_clock";
-const char* const E_GL_EXT_debug_printf                     = "GL_EXT_debug_printf";
-const char* const E_GL_EXT_ray_tracing                      = "GL_EXT_ray_tracing";
-const char* const E_GL_EXT_ray_query                        = "GL_EXT_ray_query";
-const char* const E_GL_EXT_ray_flags_primitive_culling      = "GL_EXT_ray_flags_primitive_culling";
-const char* const E_GL_EXT_blend_func_extended              = "GL_EXT_blend_func_extended";
-const char* const E_GL_EXT_shader_implicit_conversions      = "GL_EXT_shader_implicit_conversions";
+constexpr TExtension E_GL_EXT_device_group                     = { "GL_EXT_device_group", EExt_GL_EXT_device_group };
+constexpr TExtension E_GL_EXT_multiview                        = { "GL_EXT_multiview", EExt_GL_EXT_multiview };
+constexpr TExtension E_GL_EXT_post_depth_coverage              = { "GL_EXT_post_depth_coverage", EExt_GL_EXT_post_depth_coverage };
+constexpr TExtension E_GL_EXT_control_flow_attributes          = { "GL_EXT_control_flow_attributes", EExt_GL_EXT_control_flow_attributes };
+constexpr TExtension E_GL_EXT_nonuniform_qualifier             = { "GL_EXT_nonuniform_qualifier", EExt_GL_EXT_nonuniform_qualifier };
+constexpr TExtension E_GL_EXT_samplerless_texture_functions    = { "GL_EXT_samplerless_texture_functions", EExt_GL_EXT_samplerless_texture_functions };
+constexpr TExtension E_GL_EXT_scalar_block_layout              = { "GL_EXT_scalar_block_layout", EExt_GL_EXT_scalar_block_layout };
+constexpr TExtension E_GL_EXT_fragment_invocation_density      = { "GL_EXT_fragment_invocation_density", EExt_GL_EXT_fragment_invocation_density };
+constexpr TExtension E_GL_EXT_buffer_reference                 = { "GL_EXT_buffer_reference", EExt_GL_EXT_buffer_reference };
+constexpr TExtension E_GL_EXT_buffer_reference2                = { "GL_EXT_buffer_reference2", EExt_GL_EXT_buffer_reference2 };
+constexpr TExtension E_GL_EXT_buffer_reference_uvec2           = { "GL_EXT_buffer_reference_uvec2", EExt_GL_EXT_buffer_reference_uvec2 };
+constexpr TExtension E_GL_EXT_demote_to_helper_invocation      = { "GL_EXT_demote_to_helper_invocation", EExt_GL_EXT_demote_to_helper_invocation };
+constexpr TExtension E_GL_EXT_shader_realtime_clock            = { "GL_EXT_shader_realtime_clock", EExt_GL_EXT_shader_realtime_clock };
+constexpr TExtension E_GL_EXT_debug_printf                     = { "GL_EXT_debug_printf", EExt_GL_EXT_debug_printf };
+constexpr TExtension E_GL_EXT_ray_tracing                      = { "GL_EXT_ray_tracing", EExt_GL_EXT_ray_tracing };
+constexpr TExtension E_GL_EXT_ray_query                        = { "GL_EXT_ray_query", EExt_GL_EXT_ray_query };
+constexpr TExtension E_GL_EXT_ray_flags_primitive_culling      = { "GL_EXT_ray_flags_primitive_culling", EExt_GL_EXT_ray_flags_primitive_culling };
+constexpr TExtension E_GL_EXT_blend_func_extended              = { "GL_EXT_blend_func_extended", EExt_GL_EXT_blend_func_extended };
+constexpr TExtension E_GL_EXT_shader_implicit_conversions      = { "GL_EXT_shader_implicit_conversions", EExt_GL_EXT_shader_implicit_conversions };
 
 // Arrays of extensions for the above viewportEXTs duplications
 
-const char* const post_depth_coverageEXTs[] = { E_GL_ARB_post_depth_coverage, E_GL_EXT_post_depth_coverage };
+const TExtension post_depth_coverageEXTs[] = { E_GL_ARB_post_depth_coverage, E_GL_EXT_post_depth_coverage };
 const int Num_post_depth_coverageEXTs = sizeof(post_depth_coverageEXTs) / sizeof(post_depth_coverageEXTs[0]);
 
 // OVR extensions
-const char* const E_GL_OVR_multiview                    = "GL_OVR_multiview";
-const char* const E_GL_OVR_multiview2                   = "GL_OVR_multiview2";
+constexpr TExtension E_GL_OVR_multiview                    = { "GL_OVR_multiview", EExt_GL_OVR_multiview };
+constexpr TExtension E_GL_OVR_multiview2                   = { "GL_OVR_multiview2", EExt_GL_OVR_multiview2 };
 
-const char* const OVR_multiview_EXTs[] = { E_GL_OVR_multiview, E_GL_OVR_multiview2 };
+const TExtension OVR_multiview_EXTs[] = { E_GL_OVR_multiview, E_GL_OVR_multiview2 };
 const int Num_OVR_multiview_EXTs = sizeof(OVR_multiview_EXTs) / sizeof(OVR_multiview_EXTs[0]);
 
 // #line and #include
-const char* const E_GL_GOOGLE_cpp_style_line_directive          = "GL_GOOGLE_cpp_style_line_directive";
-const char* const E_GL_GOOGLE_include_directive                 = "GL_GOOGLE_include_directive";
-
-const char* const E_GL_AMD_shader_ballot                        = "GL_AMD_shader_ballot";
-const char* const E_GL_AMD_shader_trinary_minmax                = "GL_AMD_shader_trinary_minmax";
-const char* const E_GL_AMD_shader_explicit_vertex_parameter     = "GL_AMD_shader_explicit_vertex_parameter";
-const char* const E_GL_AMD_gcn_shader                           = "GL_AMD_gcn_shader";
-const char* const E_GL_AMD_gpu_shader_half_float                = "GL_AMD_gpu_shader_half_float";
-const char* const E_GL_AMD_texture_gather_bias_lod              = "GL_AMD_texture_gather_bias_lod";
-const char* const E_GL_AMD_gpu_shader_int16                     = "GL_AMD_gpu_shader_int16";
-const char* const E_GL_AMD_shader_image_load_store_lod          = "GL_AMD_shader_image_load_store_lod";
-const char* const E_GL_AMD_shader_fragment_mask                 = "GL_AMD_shader_fragment_mask";
-const char* const E_GL_AMD_gpu_shader_half_float_fetch          = "GL_AMD_gpu_shader_half_float_fetch";
-
-const char* const E_GL_INTEL_shader_integer_functions2          = "GL_INTEL_shader_integer_functions2";
-
-const char* const E_GL_NV_sample_mask_override_coverage         = "GL_NV_sample_mask_override_coverage";
-const char* const E_SPV_NV_geometry_shader_passthrough          = "GL_NV_geometry_shader_passthrough";
-const char* const E_GL_NV_viewport_array2                       = "GL_NV_viewport_array2";
-const char* const E_GL_NV_stereo_view_rendering                 = "GL_NV_stereo_view_rendering";
-const char* const E_GL_NVX_multiview_per_view_attributes        = "GL_NVX_multiview_per_view_attributes";
-const char* const E_GL_NV_shader_atomic_int64                   = "GL_NV_shader_atomic_int64";
-const char* const E_GL_NV_conservative_raster_underestimation   = "GL_NV_conservative_raster_underestimation";
-const char* const E_GL_NV_shader_noperspective_interpolation    = "GL_NV_shader_noperspective_interpolation";
-const char* const E_GL_NV_shader_subgroup_partitioned           = "GL_NV_shader_subgroup_partitioned";
-const char* const E_GL_NV_shading_rate_image                    = "GL_NV_shading_rate_image";
-const char* const E_GL_NV_ray_tracing                           = "GL_NV_ray_tracing";
-const char* const E_GL_NV_fragment_shader_barycentric           = "GL_NV_fragment_shader_barycentric";
-const char* const E_GL_NV_compute_shader_derivatives            = "GL_NV_compute_shader_derivatives";
-const char* const E_GL_NV_shader_texture_footprint              = "GL_NV_shader_texture_footprint";
-const char* const E_GL_NV_mesh_shader                           = "GL_NV_mesh_shader";
+constexpr TExtension E_GL_GOOGLE_cpp_style_line_directive          = { "GL_GOOGLE_cpp_style_line_directive", EExt_GL_GOOGLE_cpp_style_line_directive };
+constexpr TExtension E_GL_GOOGLE_include_directive                 = { "GL_GOOGLE_include_directive", EExt_GL_GOOGLE_include_directive };
+
+constexpr TExtension E_GL_AMD_shader_ballot                        = { "GL_AMD_shader_ballot", EExt_GL_AMD_shader_ballot };
+constexpr TExtension E_GL_AMD_shader_trinary_minmax                = { "GL_AMD_shader_trinary_minmax", EExt_GL_AMD_shader_trinary_minmax };
+constexpr TExtension E_GL_AMD_shader_explicit_vertex_parameter     = { "GL_AMD_shader_explicit_vertex_parameter", EExt_GL_AMD_shader_explicit_vertex_parameter };
+constexpr TExtension E_GL_AMD_gcn_shader                           = { "GL_AMD_gcn_shader", EExt_GL_AMD_gcn_shader };
+constexpr TExtension E_GL_AMD_gpu_shader_half_float                = { "GL_AMD_gpu_shader_half_float", EExt_GL_AMD_gpu_shader_half_float };
+constexpr TExtension E_GL_AMD_texture_gather_bias_lod              = { "GL_AMD_texture_gather_bias_lod", EExt_GL_AMD_texture_gather_bias_lod };
+constexpr TExtension E_GL_AMD_gpu_shader_int16                     = { "GL_AMD_gpu_shader_int16", EExt_GL_AMD_gpu_shader_int16 };
+constexpr TExtension E_GL_AMD_shader_image_load_store_lod          = { "GL_AMD_shader_image_load_store_lod", EExt_GL_AMD_shader_image_load_store_lod };
+constexpr TExtension E_GL_AMD_shader_fragment_mask                 = { "GL_AMD_shader_fragment_mask", EExt_GL_AMD_shader_fragment_mask };
+constexpr TExtension E_GL_AMD_gpu_shader_half_float_fetch          = { "GL_AMD_gpu_shader_half_float_fetch", EExt_GL_AMD_gpu_shader_half_float_fetch };
+
+constexpr TExtension E_GL_INTEL_shader_integer_functions2          = { "GL_INTEL_shader_integer_functions2", EExt_GL_INTEL_shader_integer_functions2 };
+
+constexpr TExtension E_GL_NV_sample_mask_override_coverage         = { "GL_NV_sample_mask_override_coverage", EExt_GL_NV_sample_mask_override_coverage };
+constexpr TExtension E_SPV_NV_geometry_shader_passthrough          = { "GL_NV_geometry_shader_passthrough", EExt_SPV_NV_geometry_shader_passthrough };
+constexpr TExtension E_GL_NV_viewport_array2                       = { "GL_NV_viewport_array2", EExt_GL_NV_viewport_array2 };
+constexpr TExtension E_GL_NV_stereo_view_rendering                 = { "GL_NV_stereo_view_rendering", EExt_GL_NV_stereo_view_rendering };
+constexpr TExtension E_GL_NVX_multiview_per_view_attributes        = { "GL_NVX_multiview_per_view_attributes", EExt_GL_NVX_multiview_per_view_attributes };
+constexpr TExtension E_GL_NV_shader_atomic_int64                   = { "GL_NV_shader_atomic_int64", EExt_GL_NV_shader_atomic_int64 };
+constexpr TExtension E_GL_NV_conservative_raster_underestimation   = { "GL_NV_conservative_raster_underestimation", EExt_GL_NV_conservative_raster_underestimation };
+constexpr TExtension E_GL_NV_shader_noperspective_interpolation    = { "GL_NV_shader_noperspective_interpolation", EExt_GL_NV_shader_noperspective_interpolation };
+constexpr TExtension E_GL_NV_shader_subgroup_partitioned           = { "GL_NV_shader_subgroup_partitioned", EExt_GL_NV_shader_subgroup_partitioned };
+constexpr TExtension E_GL_NV_shading_rate_image                    = { "GL_NV_shading_rate_image", EExt_GL_NV_shading_rate_image };
+constexpr TExtension E_GL_NV_ray_tracing                           = { "GL_NV_ray_tracing", EExt_GL_NV_ray_tracing };
+constexpr TExtension E_GL_NV_fragment_shader_barycentric           = { "GL_NV_fragment_shader_barycentric", EExt_GL_NV_fragment_shader_barycentric };
+constexpr TExtension E_GL_NV_compute_shader_derivatives            = { "GL_NV_compute_shader_derivatives", EExt_GL_NV_compute_shader_derivatives };
+constexpr TExtension E_GL_NV_shader_texture_footprint              = { "GL_NV_shader_texture_footprint", EExt_GL_NV_shader_texture_footprint };
+constexpr TExtension E_GL_NV_mesh_shader                           = { "GL_NV_mesh_shader", EExt_GL_NV_mesh_shader };
 
 // Arrays of extensions for the above viewportEXTs duplications
 
-const char* const viewportEXTs[] = { E_GL_ARB_shader_viewport_layer_array, E_GL_NV_viewport_array2 };
+const TExtension viewportEXTs[] = { E_GL_ARB_shader_viewport_layer_array, E_GL_NV_viewport_array2 };
 const int Num_viewportEXTs = sizeof(viewportEXTs) / sizeof(viewportEXTs[0]);
 
-const char* const E_GL_NV_cooperative_matrix                    = "GL_NV_cooperative_matrix";
-const char* const E_GL_NV_shader_sm_builtins                    = "GL_NV_shader_sm_builtins";
-const char* const E_GL_NV_integer_cooperative_matrix            = "GL_NV_integer_cooperative_matrix";
+constexpr TExtension E_GL_NV_cooperative_matrix                    = { "GL_NV_cooperative_matrix", EExt_GL_NV_cooperative_matrix };
+constexpr TExtension E_GL_NV_shader_sm_builtins                    = { "GL_NV_shader_sm_builtins", EExt_GL_NV_shader_sm_builtins };
+constexpr TExtension E_GL_NV_integer_cooperative_matrix            = { "GL_NV_integer_cooperative_matrix", EExt_GL_NV_integer_cooperative_matrix };
 
 // AEP
-const char* const E_GL_ANDROID_extension_pack_es31a             = "GL_ANDROID_extension_pack_es31a";
-const char* const E_GL_KHR_blend_equation_advanced              = "GL_KHR_blend_equation_advanced";
-const char* const E_GL_OES_sample_variables                     = "GL_OES_sample_variables";
-const char* const E_GL_OES_shader_image_atomic                  = "GL_OES_shader_image_atomic";
-const char* const E_GL_OES_shader_multisample_interpolation     = "GL_OES_shader_multisample_interpolation";
-const char* const E_GL_OES_texture_storage_multisample_2d_array = "GL_OES_texture_storage_multisample_2d_array";
-const char* const E_GL_EXT_geometry_shader                      = "GL_EXT_geometry_shader";
-const char* const E_GL_EXT_geometry_point_size                  = "GL_EXT_geometry_point_size";
-const char* const E_GL_EXT_gpu_shader5                          = "GL_EXT_gpu_shader5";
-const char* const E_GL_EXT_primitive_bounding_box               = "GL_EXT_primitive_bounding_box";
-const char* const E_GL_EXT_shader_io_blocks                     = "GL_EXT_shader_io_blocks";
-const char* const E_GL_EXT_tessellation_shader                  = "GL_EXT_tessellation_shader";
-const char* const E_GL_EXT_tessellation_point_size              = "GL_EXT_tessellation_point_size";
-const char* const E_GL_EXT_texture_buffer                       = "GL_EXT_texture_buffer";
-const char* const E_GL_EXT_texture_cube_map_array               = "GL_EXT_texture_cube_map_array";
-const char* const E_GL_EXT_shader_integer_mix                   = "GL_EXT_shader_integer_mix"; 
+constexpr TExtension E_GL_ANDROID_extension_pack_es31a             = { "GL_ANDROID_extension_pack_es31a", EExt_GL_ANDROID_extension_pack_es31a };
+constexpr TExtension E_GL_KHR_blend_equation_advanced              = { "GL_KHR_blend_equation_advanced", EExt_GL_KHR_blend_equation_advanced };
+constexpr TExtension E_GL_OES_sample_variables                     = { "GL_OES_sample_variables", EExt_GL_OES_sample_variables };
+constexpr TExtension E_GL_OES_shader_image_atomic                  = { "GL_OES_shader_image_atomic", EExt_GL_OES_shader_image_atomic };
+constexpr TExtension E_GL_OES_shader_multisample_interpolation     = { "GL_OES_shader_multisample_interpolation", EExt_GL_OES_shader_multisample_interpolation };
+constexpr TExtension E_GL_OES_texture_storage_multisample_2d_array = { "GL_OES_texture_storage_multisample_2d_array", EExt_GL_OES_texture_storage_multisample_2d_array };
+constexpr TExtension E_GL_EXT_geometry_shader                      = { "GL_EXT_geometry_shader", EExt_GL_EXT_geometry_shader };
+constexpr TExtension E_GL_EXT_geometry_point_size                  = { "GL_EXT_geometry_point_size", EExt_GL_EXT_geometry_point_size };
+constexpr TExtension E_GL_EXT_gpu_shader5                          = { "GL_EXT_gpu_shader5", EExt_GL_EXT_gpu_shader5 };
+constexpr TExtension E_GL_EXT_primitive_bounding_box               = { "GL_EXT_primitive_bounding_box", EExt_GL_EXT_primitive_bounding_box };
+constexpr TExtension E_GL_EXT_shader_io_blocks                     = { "GL_EXT_shader_io_blocks", EExt_GL_EXT_shader_io_blocks };
+constexpr TExtension E_GL_EXT_tessellation_shader                  = { "GL_EXT_tessellation_shader", EExt_GL_EXT_tessellation_shader };
+constexpr TExtension E_GL_EXT_tessellation_point_size              = { "GL_EXT_tessellation_point_size", EExt_GL_EXT_tessellation_point_size };
+constexpr TExtension E_GL_EXT_texture_buffer                       = { "GL_EXT_texture_buffer", EExt_GL_EXT_texture_buffer };
+constexpr TExtension E_GL_EXT_texture_cube_map_array               = { "GL_EXT_texture_cube_map_array", EExt_GL_EXT_texture_cube_map_array };
+constexpr TExtension E_GL_EXT_shader_integer_mix                   = { "GL_EXT_shader_integer_mix", EExt_GL_EXT_shader_integer_mix }; 
 
 // OES matching AEP
-const char* const E_GL_OES_geometry_shader                      = "GL_OES_geometry_shader";
-const char* const E_GL_OES_geometry_point_size                  = "GL_OES_geometry_point_size";
-const char* const E_GL_OES_gpu_shader5                          = "GL_OES_gpu_shader5";
-const char* const E_GL_OES_primitive_bounding_box               = "GL_OES_primitive_bounding_box";
-const char* const E_GL_OES_shader_io_blocks                     = "GL_OES_shader_io_blocks";
-const char* const E_GL_OES_tessellation_shader                  = "GL_OES_tessellation_shader";
-const char* const E_GL_OES_tessellation_point_size              = "GL_OES_tessellation_point_size";
-const char* const E_GL_OES_texture_buffer                       = "GL_OES_texture_buffer";
-const char* const E_GL_OES_texture_cube_map_array               = "GL_OES_texture_cube_map_array";
+constexpr TExtension E_GL_OES_geometry_shader                      = { "GL_OES_geometry_shader", EExt_GL_OES_geometry_shader };
+constexpr TExtension E_GL_OES_geometry_point_size                  = { "GL_OES_geometry_point_size", EExt_GL_OES_geometry_point_size };
+constexpr TExtension E_GL_OES_gpu_shader5                          = { "GL_OES_gpu_shader5", EExt_GL_OES_gpu_shader5 };
+constexpr TExtension E_GL_OES_primitive_bounding_box               = { "GL_OES_primitive_bounding_box", EExt_GL_OES_primitive_bounding_box };
+constexpr TExtension E_GL_OES_shader_io_blocks                     = { "GL_OES_shader_io_blocks", EExt_GL_OES_shader_io_blocks };
+constexpr TExtension E_GL_OES_tessellation_shader                  = { "GL_OES_tessellation_shader", EExt_GL_OES_tessellation_shader };
+constexpr TExtension E_GL_OES_tessellation_point_size              = { "GL_OES_tessellation_point_size", EExt_GL_OES_tessellation_point_size };
+constexpr TExtension E_GL_OES_texture_buffer                       = { "GL_OES_texture_buffer", EExt_GL_OES_texture_buffer };
+constexpr TExtension E_GL_OES_texture_cube_map_array               = { "GL_OES_texture_cube_map_array", EExt_GL_OES_texture_cube_map_array };
 
 // EXT
-const char* const E_GL_EXT_shader_explicit_arithmetic_types          = "GL_EXT_shader_explicit_arithmetic_types";
-const char* const E_GL_EXT_shader_explicit_arithmetic_types_int8     = "GL_EXT_shader_explicit_arithmetic_types_int8";
-const char* const E_GL_EXT_shader_explicit_arithmetic_types_int16    = "GL_EXT_shader_explicit_arithmetic_types_int16";
-const char* const E_GL_EXT_shader_explicit_arithmetic_types_int32    = "GL_EXT_shader_explicit_arithmetic_types_int32";
-const char* const E_GL_EXT_shader_explicit_arithmetic_types_int64    = "GL_EXT_shader_explicit_arithmetic_types_int64";
-const char* const E_GL_EXT_shader_explicit_arithmetic_types_float16  = "GL_EXT_shader_explicit_arithmetic_types_float16";
-const char* const E_GL_EXT_shader_explicit_arithmetic_types_float32  = "GL_EXT_shader_explicit_arithmetic_types_float32";
-const char* const E_GL_EXT_shader_explicit_arithmetic_types_float64  = "GL_EXT_shader_explicit_arithmetic_types_float64";
-
-const char* const E_GL_EXT_shader_subgroup_extended_types_int8    = "GL_EXT_shader_subgroup_extended_types_int8";
-const char* const E_GL_EXT_shader_subgroup_extended_types_int16   = "GL_EXT_shader_subgroup_extended_types_int16";
-const char* const E_GL_EXT_shader_subgroup_extended_types_int64   = "GL_EXT_shader_subgroup_extended_types_int64";
-const char* const E_GL_EXT_shader_subgroup_extended_types_float16 = "GL_EXT_shader_subgroup_extended_types_float16";
+constexpr TExtension E_GL_EXT_shader_explicit_arithmetic_types          = { "GL_EXT_shader_explicit_arithmetic_types", EExt_GL_EXT_shader_explicit_arithmetic_types };
+constexpr TExtension E_GL_EXT_shader_explicit_arithmetic_types_int8     = { "GL_EXT_shader_explicit_arithmetic_types_int8", EExt_GL_EXT_shader_explicit_arithmetic_types_int8 };
+constexpr TExtension E_GL_EXT_shader_explicit_arithmetic_types_int16    = { "GL_EXT_shader_explicit_arithmetic_types_int16", EExt_GL_EXT_shader_explicit_arithmetic_types_int16 };
+constexpr TExtension E_GL_EXT_shader_explicit_arithmetic_types_int32    = { "GL_EXT_shader_explicit_arithmetic_types_int32", EExt_GL_EXT_shader_explicit_arithmetic_types_int32 };
+constexpr TExtension E_GL_EXT_shader_explicit_arithmetic_types_int64    = { "GL_EXT_shader_explicit_arithmetic_types_int64", EExt_GL_EXT_shader_explicit_arithmetic_types_int64 };
+constexpr TExtension E_GL_EXT_shader_explicit_arithmetic_types_float16  = { "GL_EXT_shader_explicit_arithmetic_types_float16", EExt_GL_EXT_shader_explicit_arithmetic_types_float16 };
+constexpr TExtension E_GL_EXT_shader_explicit_arithmetic_types_float32  = { "GL_EXT_shader_explicit_arithmetic_types_float32", EExt_GL_EXT_shader_explicit_arithmetic_types_float32 };
+constexpr TExtension E_GL_EXT_shader_explicit_arithmetic_types_float64  = { "GL_EXT_shader_explicit_arithmetic_types_float64", EExt_GL_EXT_shader_explicit_arithmetic_types_float64 };
+
+constexpr TExtension E_GL_EXT_shader_subgroup_extended_types_int8    = { "GL_EXT_shader_subgroup_extended_types_int8", EExt_GL_EXT_shader_subgroup_extended_types_int8 };
+constexpr TExtension E_GL_EXT_shader_subgroup_extended_types_int16   = { "GL_EXT_shader_subgroup_extended_types_int16", EExt_GL_EXT_shader_subgroup_extended_types_int16 };
+constexpr TExtension E_GL_EXT_shader_subgroup_extended_types_int64   = { "GL_EXT_shader_subgroup_extended_types_int64", EExt_GL_EXT_shader_subgroup_extended_types_int64 };
+constexpr TExtension E_GL_EXT_shader_subgroup_extended_types_float16 = { "GL_EXT_shader_subgroup_extended_types_float16", EExt_GL_EXT_shader_subgroup_extended_types_float16 };
 
 // Arrays of extensions for the above AEP duplications
 
-const char* const AEP_geometry_shader[] = { E_GL_EXT_geometry_shader, E_GL_OES_geometry_shader };
+const TExtension AEP_geometry_shader[] = { E_GL_EXT_geometry_shader, E_GL_OES_geometry_shader };
 const int Num_AEP_geometry_shader = sizeof(AEP_geometry_shader)/sizeof(AEP_geometry_shader[0]);
 
-const char* const AEP_geometry_point_size[] = { E_GL_EXT_geometry_point_size, E_GL_OES_geometry_point_size };
+const TExtension AEP_geometry_point_size[] = { E_GL_EXT_geometry_point_size, E_GL_OES_geometry_point_size };
 const int Num_AEP_geometry_point_size = sizeof(AEP_geometry_point_size)/sizeof(AEP_geometry_point_size[0]);
 
-const char* const AEP_gpu_shader5[] = { E_GL_EXT_gpu_shader5, E_GL_OES_gpu_shader5 };
+const TExtension AEP_gpu_shader5[] = { E_GL_EXT_gpu_shader5, E_GL_OES_gpu_shader5 };
 const int Num_AEP_gpu_shader5 = sizeof(AEP_gpu_shader5)/sizeof(AEP_gpu_shader5[0]);
 
-const char* const AEP_primitive_bounding_box[] = { E_GL_EXT_primitive_bounding_box, E_GL_OES_primitive_bounding_box };
+const TExtension AEP_primitive_bounding_box[] = { E_GL_EXT_primitive_bounding_box, E_GL_OES_primitive_bounding_box };
 const int Num_AEP_primitive_bounding_box = sizeof(AEP_primitive_bounding_box)/sizeof(AEP_primitive_bounding_box[0]);
 
-const char* const AEP_shader_io_blocks[] = { E_GL_EXT_shader_io_blocks, E_GL_OES_shader_io_blocks };
+const TExtension AEP_shader_io_blocks[] = { E_GL_EXT_shader_io_blocks, E_GL_OES_shader_io_blocks };
 const int Num_AEP_shader_io_blocks = sizeof(AEP_shader_io_blocks)/sizeof(AEP_shader_io_blocks[0]);
 
-const char* const AEP_tessellation_shader[] = { E_GL_EXT_tessellation_shader, E_GL_OES_tessellation_shader };
+const TExtension AEP_tessellation_shader[] = { E_GL_EXT_tessellation_shader, E_GL_OES_tessellation_shader };
 const int Num_AEP_tessellation_shader = sizeof(AEP_tessellation_shader)/sizeof(AEP_tessellation_shader[0]);
 
-const char* const AEP_tessellation_point_size[] = { E_GL_EXT_tessellation_point_size, E_GL_OES_tessellation_point_size };
+const TExtension AEP_tessellation_point_size[] = { E_GL_EXT_tessellation_point_size, E_GL_OES_tessellation_point_size };
 const int Num_AEP_tessellation_point_size = sizeof(AEP_tessellation_point_size)/sizeof(AEP_tessellation_point_size[0]);
 
-const char* const AEP_texture_buffer[] = { E_GL_EXT_texture_buffer, E_GL_OES_texture_buffer };
+const TExtension AEP_texture_buffer[] = { E_GL_EXT_texture_buffer, E_GL_OES_texture_buffer };
 const int Num_AEP_texture_buffer = sizeof(AEP_texture_buffer)/sizeof(AEP_texture_buffer[0]);
 
-const char* const AEP_texture_cube_map_array[] = { E_GL_EXT_texture_cube_map_array, E_GL_OES_texture_cube_map_array };
+const TExtension AEP_texture_cube_map_array[] = { E_GL_EXT_texture_cube_map_array, E_GL_OES_texture_cube_map_array };
 const int Num_AEP_texture_cube_map_array = sizeof(AEP_texture_cube_map_array)/sizeof(AEP_texture_cube_map_array[0]);
 
 } // end namespace glslang
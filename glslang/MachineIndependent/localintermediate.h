@@ -246,7 +246,10 @@ public:
         invertY(false),
         useStorageBuffer(false),
         nanMinMaxClamp(false),
-        depthReplacing(false)
+        depthReplacing(false),
+        spirvMemory(nullptr),
+        includeCache(nullptr),
+        builtInResolutions(0), reusedBuiltInResolutions(0)
 #ifndef GLSLANG_WEB
         ,
         implicitThisName("@this"), implicitCounterName("@count"),
@@ -367,6 +370,22 @@ public:
 
     const std::map<std::string, TExtensionBehavior>& getRequestedExtensions() const { return requestedExtensions; }
 
+    // Where the SPIR-V back end, which only reads the intermediate, records the
+    // memory it used for it.  Kept by the shader or program owning the intermediate.
+    void setSpirvMemoryRecord(TMemoryUsage* record) { spirvMemory = record; }
+    TMemoryUsage* getSpirvMemoryRecord() const { return spirvMemory; }
+
+    // Calls the parser resolved to built-in functions, and how many of those
+    // reused the resolution of an earlier call of the same signature.
+    void addBuiltInResolution(bool reused)
+    {
+        ++builtInResolutions;
+        if (reused)
+            ++reusedBuiltInResolutions;
+    }
+    int getBuiltInResolutions() const { return builtInResolutions; }
+    int getReusedBuiltInResolutions() const { return reusedBuiltInResolutions; }
+
     void setTreeRoot(TIntermNode* r) { treeRoot = r; }
     TIntermNode* getTreeRoot() const { return treeRoot; }
     void incrementEntryPointCount() { ++numEntryPoints; }
@@ -842,6 +861,8 @@ public:
     const std::string& getSourceText() const { return sourceText; }
     const std::map<std::string, std::string>& getIncludeText() const { return includeText; }
     void addIncludeText(const char* name, const char* text, size_t len) { includeText[name].assign(text,len); }
+    void setIncludeCache(TIncludeCache* cache) { includeCache = cache; }
+    TIncludeCache* getIncludeCache() const { return includeCache; }
     void addProcesses(const std::vector<std::string>& p)
     {
         for (int i = 0; i < (int)p.size(); ++i)
@@ -943,6 +964,10 @@ protected:
     bool useStorageBuffer;
     bool nanMinMaxClamp;            // true if desiring min/max/clamp to favor non-NaN over NaN
     bool depthReplacing;
+    TMemoryUsage* spirvMemory;      // not owned; nullptr if not recorded
+    TIncludeCache* includeCache;    // where to replay and record the tokens of included files, if anywhere
+    int builtInResolutions;
+    int reusedBuiltInResolutions;
     int localSize[3];
     bool localSizeNotDefault[3];
     int localSizeSpecId[3];
@@ -65,7 +65,13 @@ public:
         infoSink(infoSink), version(version), 
         language(language),
         spvVersion(spvVersion), 
-        intermediate(interm), messages(messages), numErrors(0), currentScanner(0) { }
+        intermediate(interm), messages(messages), numErrors(0), currentScanner(0)
+    {
+#ifndef GLSLANG_WEB
+        // every extension is missing until initializeExtensionBehavior(), as when parsing built-ins
+        extensionBehavior.assign(EExtCount, EBhMissing);
+#endif
+    }
     virtual ~TParseVersions() { }
     void requireStage(const TSourceLoc&, EShLanguageMask, const char* featureDesc);
     void requireStage(const TSourceLoc&, EShLanguage, const char* featureDesc);
@@ -78,26 +84,31 @@ public:
             error(loc, "not supported with this profile:", featureDesc, ProfileName(profile));
     }
     void profileRequires(const TSourceLoc& loc, int profileMask, int minVersion, int numExtensions,
-        const char* const extensions[], const char* featureDesc)
+        const TExtension extensions[], const char* featureDesc)
     {
         if ((EEsProfile & profileMask) && (minVersion == 0 || version < minVersion))
             error(loc, "not supported for this version or the enabled extensions", featureDesc, "");
     }
-    void profileRequires(const TSourceLoc& loc, int profileMask, int minVersion, const char* extension,
+    void profileRequires(const TSourceLoc& loc, int profileMask, int minVersion, TExtension extension,
         const char* featureDesc)
     {
-        profileRequires(loc, profileMask, minVersion, extension ? 1 : 0, &extension, featureDesc);
+        profileRequires(loc, profileMask, minVersion, 1, &extension, featureDesc);
+    }
+    void profileRequires(const TSourceLoc& loc, int profileMask, int minVersion, std::nullptr_t,
+        const char* featureDesc)
+    {
+        profileRequires(loc, profileMask, minVersion, 0, nullptr, featureDesc);
     }
     void initializeExtensionBehavior() { }
     void checkDeprecated(const TSourceLoc&, int queryProfiles, int depVersion, const char* featureDesc) { }
     void requireNotRemoved(const TSourceLoc&, int queryProfiles, int removedVersion, const char* featureDesc) { }
-    void requireExtensions(const TSourceLoc&, int numExtensions, const char* const extensions[],
+    void requireExtensions(const TSourceLoc&, int numExtensions, const TExtension extensions[],
         const char* featureDesc) { }
-    void ppRequireExtensions(const TSourceLoc&, int numExtensions, const char* const extensions[],
+    void ppRequireExtensions(const TSourceLoc&, int numExtensions, const TExtension extensions[],
         const char* featureDesc) { }
-    TExtensionBehavior getExtensionBehavior(const char*) { return EBhMissing; }
-    bool extensionTurnedOn(const char* const extension) { return false; }
-    bool extensionsTurnedOn(int numExtensions, const char* const extensions[]) { return false; }
+    TExtensionBehavior getExtensionBehavior(TExtension) { return EBhMissing; }
+    bool extensionTurnedOn(TExtension extension) { return false; }
+    bool extensionsTurnedOn(int numExtensions, const TExtension extensions[]) { return false; }
     void updateExtensionBehavior(int line, const char* const extension, const char* behavior) { }
     void updateExtensionBehavior(const char* const extension, TExtensionBehavior) { }
     void checkExtensionStage(const TSourceLoc&, const char* const extension) { }
@@ -122,22 +133,25 @@ public:
     bool isEsProfile() const { return profile == EEsProfile; }
     void requireProfile(const TSourceLoc& loc, int profileMask, const char* featureDesc);
     void profileRequires(const TSourceLoc& loc, int profileMask, int minVersion, int numExtensions,
-        const char* const extensions[], const char* featureDesc);
-    void profileRequires(const TSourceLoc& loc, int profileMask, int minVersion, const char* extension,
+        const TExtension extensions[], const char* featureDesc);
+    void profileRequires(const TSourceLoc& loc, int profileMask, int minVersion, TExtension extension,
+        const char* featureDesc);
+    void profileRequires(const TSourceLoc& loc, int profileMask, int minVersion, std::nullptr_t,
         const char* featureDesc);
+    static void fillInExtensionMap();
     virtual void initializeExtensionBehavior();
     virtual void checkDeprecated(const TSourceLoc&, int queryProfiles, int depVersion, const char* featureDesc);
     virtual void requireNotRemoved(const TSourceLoc&, int queryProfiles, int removedVersion, const char* featureDesc);
-    virtual void requireExtensions(const TSourceLoc&, int numExtensions, const char* const extensions[],
+    virtual void requireExtensions(const TSourceLoc&, int numExtensions, const TExtension extensions[],
         const char* featureDesc);
-    virtual void ppRequireExtensions(const TSourceLoc&, int numExtensions, const char* const extensions[],
+    virtual void ppRequireExtensions(const TSourceLoc&, int numExtensions, const TExtension extensions[],
         const char* featureDesc);
-    virtual TExtensionBehavior getExtensionBehavior(const char*);
-    virtual bool extensionTurnedOn(const char* const extension);
-    virtual bool extensionsTurnedOn(int numExtensions, const char* const extensions[]);
+    virtual TExtensionBehavior getExtensionBehavior(TExtension);
+    virtual bool extensionTurnedOn(TExtension extension);
+    virtual bool extensionsTurnedOn(int numExtensions, const TExtension extensions[]);
     virtual void updateExtensionBehavior(int line, const char* const extension, const char* behavior);
     virtual void updateExtensionBehavior(const char* const extension, TExtensionBehavior);
-    virtual bool checkExtensionsRequested(const TSourceLoc&, int numExtensions, const char* const extensions[],
+    virtual bool checkExtensionsRequested(const TSourceLoc&, int numExtensions, const TExtension extensions[],
         const char* featureDesc);
     virtual void checkExtensionStage(const TSourceLoc&, const char* const extension);
     virtual void extensionRequires(const TSourceLoc&, const char* const extension, const char* behavior);
@@ -224,8 +238,7 @@ public:
     TIntermediate& intermediate; // helper for making and hooking up pieces of the parse tree
 
 protected:
-    TMap<TString, TExtensionBehavior> extensionBehavior;    // for each extension string, what its current behavior is set to
-    TMap<TString, unsigned int> extensionMinSpv;            // for each extension string, store minimum spirv required
+    TVector<TExtensionBehavior> extensionBehavior;    // for each extension id, what its current behavior is set to
     EShMessages messages;        // errors/warnings/rule-sets
     int numErrors;               // number of compile-time errors encountered
     TInputScanner* currentScanner;
@@ -275,13 +275,17 @@ int TPpContext::CPPelse(int matchelse, TPpToken* ppToken)
             --elsetracker;
             if (depth == 0) {
                 // found the #endif we are looking for
-                if (ifdepth > 0)
+                if (ifdepth > 0) {
                     --ifdepth;
+                    includeGuardEndif();
+                }
                 break;
             }
             --depth;
             --ifdepth;
         } else if (matchelse && depth == 0) {
+            if (nextAtom == PpAtomElse || nextAtom == PpAtomElif)
+                includeGuardElse();
             if (nextAtom == PpAtomElse) {
                 elseSeen[elsetracker] = true;
                 token = extraTokenCheck(nextAtom, ppToken, scanToken(ppToken));
@@ -601,7 +605,10 @@ int TPpContext::CPPifdef(int defined, TPpToken* ppToken)
         else
             parseContext.ppError(ppToken->loc, "must be followed by macro name", "#ifndef", "");
     } else {
-        MacroSymbol* macro = lookupMacroDef(atomStrings.getAtom(ppToken->name));
+        int atom = defined ? atomStrings.getAtom(ppToken->name) : atomStrings.getAddAtom(ppToken->name);
+        if (! defined)
+            includeGuardIfndef(atom);
+        MacroSymbol* macro = lookupMacroDef(atom);
         token = scanToken(ppToken);
         if (token != '\n') {
             parseContext.ppError(ppToken->loc, "unexpected tokens following #ifdef directive - expected a newline", "#ifdef", "");
@@ -661,6 +668,17 @@ int TPpContext::CPPinclude(TPpToken* ppToken)
 
     // Process well-formed directive
 
+    // Skip it, without even asking the includer, when the same directive from the
+    // same place resolved earlier to a header that would now be empty: one whose
+    // include guard macro is defined, or one with #pragma once.
+    std::string inclusion = (startWithLocalSearch ? "\"" : "<") + filename;
+    inclusion += '\0' + rootFileName;
+    for (size_t i = 0; i < includeStack.size(); ++i)
+        inclusion += '\0' + includeStack[i]->headerName;
+    auto resolved = resolvedIncludes.find(inclusion);
+    if (resolved != resolvedIncludes.end() && includeIsGuarded(resolved->second))
+        return token;
+
     // Find the inclusion, first look in "Local" ("") paths, if requested,
     // otherwise, only search the "System" (<>) paths.
     TShader::Includer::IncludeResult* res = nullptr;
@@ -673,7 +691,11 @@ int TPpContext::CPPinclude(TPpToken* ppToken)
 
     // Process the results
     if (res != nullptr && !res->headerName.empty()) {
-        if (res->headerData != nullptr && res->headerLength > 0) {
+        resolvedIncludes[inclusion] = res->headerName;
+        if (includeIsGuarded(res->headerName)) {
+            // a different directive reached a header already included, that would now be empty
+            includer.releaseInclude(res);
+        } else if (res->headerData != nullptr && res->headerLength > 0) {
             // path for processing one or more tokens from an included header, hand off 'res'
             const bool forNextLine = parseContext.lineDirectiveShouldSetNextLine();
             std::ostringstream prologue;
@@ -681,7 +703,8 @@ int TPpContext::CPPinclude(TPpToken* ppToken)
             prologue << "#line " << forNextLine << " " << "\"" << res->headerName << "\"\n";
             epilogue << (res->headerData[res->headerLength - 1] == '\n'? "" : "\n") <<
                 "#line " << directiveLoc.line + forNextLine << " " << directiveLoc.getStringNameOrNum() << "\n";
-            pushInput(new TokenizableIncludeFile(directiveLoc, prologue.str(), res, epilogue.str(), this));
+            pushInput(new TokenizableIncludeFile(directiveLoc, prologue.str(), res, epilogue.str(), this,
+                                                 parseContext.intermediate.getIncludeCache()));
             parseContext.intermediate.addIncludeText(res->headerName.c_str(), res->headerData, res->headerLength);
             // There's no "current" location anymore.
             parseContext.setCurrentColumn(0);
@@ -701,6 +724,39 @@ int TPpContext::CPPinclude(TPpToken* ppToken)
     return token;
 }
 
+// Include-guard recognition, through the directives of the innermost file being
+// included, if any; see TokenizableIncludeFile.
+void TPpContext::includeGuardIfndef(int atom)
+{
+    if (! inputStack.empty() && inputStack.back()->isIncludeFile())
+        static_cast<TokenizableIncludeFile*>(inputStack.back())->guardIfndef(atom, ifdepth);
+}
+
+void TPpContext::includeGuardElse()
+{
+    if (! inputStack.empty() && inputStack.back()->isIncludeFile())
+        static_cast<TokenizableIncludeFile*>(inputStack.back())->guardElse(ifdepth);
+}
+
+void TPpContext::includeGuardEndif()
+{
+    if (! inputStack.empty() && inputStack.back()->isIncludeFile())
+        static_cast<TokenizableIncludeFile*>(inputStack.back())->guardEndif(ifdepth);
+}
+
+// Whether including the given resolved header again would add nothing.
+bool TPpContext::includeIsGuarded(const std::string& headerName)
+{
+    auto guard = includeGuards.find(headerName);
+    if (guard == includeGuards.end())
+        return false;
+    if (guard->second == 0)
+        return true;
+
+    MacroSymbol* macro = lookupMacroDef(guard->second);
+    return macro != nullptr && ! macro->undef;
+}
+
 // Handle #line
 int TPpContext::CPPline(TPpToken* ppToken)
 {
@@ -827,8 +883,12 @@ int TPpContext::CPPpragma(TPpToken* ppToken)
 
     if (token == EndOfInput)
         parseContext.ppError(loc, "directive must end with a newline", "#pragma", "");
-    else
+    else {
+        // an included file with #pragma once is not included again
+        if (tokens.size() == 1 && tokens[0] == "once" && ! includeStack.empty())
+            includeGuards[includeStack.back()->headerName] = 0;
         parseContext.handlePragma(loc, tokens);
+    }
 
     return token;
 }
@@ -932,6 +992,7 @@ int TPpContext::readCPPline(TPpToken* ppToken)
             token = CPPdefine(ppToken);
             break;
         case PpAtomElse:
+            includeGuardElse();
             if (elseSeen[elsetracker])
                 parseContext.ppError(ppToken->loc, "#else after #else", "#else", "");
             elseSeen[elsetracker] = true;
@@ -941,6 +1002,7 @@ int TPpContext::readCPPline(TPpToken* ppToken)
             token = CPPelse(0, ppToken);
             break;
         case PpAtomElif:
+            includeGuardElse();
             if (ifdepth == 0)
                 parseContext.ppError(ppToken->loc, "mismatched statements", "#elif", "");
             if (elseSeen[elsetracker])
@@ -958,6 +1020,7 @@ int TPpContext::readCPPline(TPpToken* ppToken)
                 elseSeen[elsetracker] = false;
                 --elsetracker;
                 --ifdepth;
+                includeGuardEndif();
             }
             token = extraTokenCheck(PpAtomEndif, ppToken, scanToken(ppToken));
             break;
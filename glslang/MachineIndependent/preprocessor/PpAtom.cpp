@@ -83,9 +83,12 @@ NVIDIA HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
+#include <deque>
+#include <string>
 
 #include "PpContext.h"
 #include "PpTokens.h"
+#include "../Hash.h"
 
 namespace {
 
@@ -149,33 +152,198 @@ const struct {
     { PpAtomInclude,         "include" },
 };
 
-} // end anonymous namespace
+// Atom 0 marks an empty slot.
+bool IsEmptyAtomSlot(int atom)
+{
+    return atom == 0;
+}
 
-namespace glslang {
+// Find 's' among the atoms in 'slots', an open-addressed table whose size is a
+// power of 2, where 'strings[atom - firstAtom]' is the string of 'atom'.
+// Returns the atom, or 0 if not found; 'slot' is left where it was or would go.
+template<class Strings, class Slots>
+int FindAtom(const Strings& strings, int firstAtom, const Slots& slots, const char* s, unsigned int hash,
+             size_t& slot)
+{
+    slot = ProbeSlots(slots, hash, IsEmptyAtomSlot,
+                      [&](int atom) { return strcmp(strings[atom - firstAtom], s) == 0; });
+
+    return slots[slot];
+}
 
 //
-// Initialize the atom table.
+// The process-wide atom table, made on first use and never changed after.
 //
-TStringAtomMap::TStringAtomMap()
-{
-    badToken.assign("<bad token>");
+class TGlobalAtoms {
+public:
+    TGlobalAtoms();
+
+    int find(const char* s, unsigned int hash) const
+    {
+        size_t slot;
+        return FindAtom(strings, 0, slots, s, hash, slot);
+    }
+    const char* const* getStrings() const { return strings.data(); }
+    int getNextAtom() const { return (int)strings.size(); }
+
+protected:
+    void add(const char* s, int atom);
+    void addPreambleMacros(int version, EProfile profile, const SpvVersion&);
+
+    std::vector<const char*> strings;   // atom -> string, "<bad token>" for atoms without one
+    std::vector<int> slots;
+    std::deque<std::string> names;      // storage for the strings not in static storage
+};
+
+const char* const BadToken = "<bad token>";
 
+TGlobalAtoms::TGlobalAtoms() : strings(PpAtomLast, BadToken), slots(1024, 0)
+{
     // Add single character tokens to the atom table:
     const char* s = "~!%^&*()-+=|,.<>/?;:[]{}#\\";
-    char t[2];
-
-    t[1] = '\0';
     while (*s) {
-        t[0] = *s;
-        addAtomFixed(t, s[0]);
+        names.push_back(std::string(1, *s));
+        add(names.back().c_str(), s[0]);
         s++;
     }
 
     // Add multiple character scanner tokens :
     for (size_t ii = 0; ii < sizeof(tokens)/sizeof(tokens[0]); ii++)
-        addAtomFixed(tokens[ii].str, tokens[ii].val);
+        add(tokens[ii].str, tokens[ii].val);
+
+    // Add the macros every shader of some kind defines in its preamble, so
+    // defining them needs no per-shader atoms.
+    SpvVersion spvVersion;
+    addPreambleMacros(100, EEsProfile, spvVersion);
+    addPreambleMacros(320, EEsProfile, spvVersion);
+    addPreambleMacros(110, ENoProfile, spvVersion);
+    addPreambleMacros(460, ECompatibilityProfile, spvVersion);
+    spvVersion.vulkanGlsl = 100;
+    spvVersion.openGl = 100;
+    addPreambleMacros(460, ECoreProfile, spvVersion);
+}
+
+void TGlobalAtoms::add(const char* s, int atom)
+{
+    size_t slot;
+    const unsigned int hash = HashFnvString(FnvBasis, s);
+    if (FindAtom(strings, 0, slots, s, hash, slot) != 0)
+        return;
+
+    // keep the table at most half full
+    if (strings.size() + 1 > slots.size() / 2) {
+        std::vector<int> grown(slots.size() * 2, 0);
+        slots.swap(grown);
+        for (int a : grown) {
+            if (a != 0)
+                slots[ProbeSlots(slots, HashFnvString(FnvBasis, strings[a]), IsEmptyAtomSlot, NoMatch())] = a;
+        }
+        slot = ProbeSlots(slots, hash, IsEmptyAtomSlot, NoMatch());
+    }
+
+    if (strings.size() < (size_t)atom + 1)
+        strings.resize(atom + 1, BadToken);
+    strings[atom] = s;
+    slots[slot] = atom;
+}
+
+// Just enough of a parse context to make a preamble.
+class TPreambleVersions : public TParseVersions {
+public:
+    TPreambleVersions(TIntermediate& intermediate, int version, EProfile profile, const SpvVersion& spvVersion,
+                      TInfoSink& infoSink)
+        : TParseVersions(intermediate, version, profile, spvVersion, EShLangVertex, infoSink, false, EShMsgDefault)
+    { }
+#ifndef GLSLANG_WEB
+    virtual void C_DECL error(const TSourceLoc&, const char*, const char*, const char*, ...) override { }
+    virtual void C_DECL warn(const TSourceLoc&, const char*, const char*, const char*, ...) override { }
+    virtual void C_DECL ppError(const TSourceLoc&, const char*, const char*, const char*, ...) override { }
+    virtual void C_DECL ppWarn(const TSourceLoc&, const char*, const char*, const char*, ...) override { }
+#endif
+};
+
+void TGlobalAtoms::addPreambleMacros(int version, EProfile profile, const SpvVersion& spvVersion)
+{
+    // The preamble only depends on the arguments here.
+    TInfoSink infoSink;
+    TIntermediate intermediate(EShLangVertex);
+    TPreambleVersions parseVersions(intermediate, version, profile, spvVersion, infoSink);
+    std::string preamble;
+    parseVersions.getPreamble(preamble);
+
+    const std::string define = "#define ";
+    for (size_t pos = preamble.find(define); pos != std::string::npos; pos = preamble.find(define, pos)) {
+        pos += define.size();
+        size_t end = preamble.find_first_of(" \n(", pos);
+        names.push_back(preamble.substr(pos, end - pos));
+        add(names.back().c_str(), getNextAtom());
+    }
+}
+
+const TGlobalAtoms& GetGlobalAtoms()
+{
+    static const TGlobalAtoms globalAtoms;
+    return globalAtoms;
+}
+
+} // end anonymous namespace
+
+namespace glslang {
+
+//
+// Initialize the atom table, over the process-wide one.
+//
+TStringAtomMap::TStringAtomMap()
+{
+    const TGlobalAtoms& globalAtoms = GetGlobalAtoms();
+    globalStrings = globalAtoms.getStrings();
+    firstAtom = globalAtoms.getNextAtom();
+}
+
+int TStringAtomMap::getAtom(const char* s) const
+{
+    return find(s, HashFnvString(FnvBasis, s));
+}
+
+int TStringAtomMap::getAddAtom(const char* s)
+{
+    unsigned int hash = HashFnvString(FnvBasis, s);
+    int atom = find(s, hash);
+    if (atom != 0)
+        return atom;
+
+    // keep the table at most half full
+    if (strings.size() + 1 > slots.size() / 2) {
+        TVector<int> grown(std::max((size_t)64, slots.size() * 2), 0);
+        slots.swap(grown);
+        for (int a : grown) {
+            if (a != 0) {
+                unsigned int grownHash = HashFnvString(FnvBasis, strings[a - firstAtom]);
+                slots[ProbeSlots(slots, grownHash, IsEmptyAtomSlot, NoMatch())] = a;
+            }
+        }
+    }
+
+    size_t length = strlen(s);
+    char* copy = static_cast<char*>(GetThreadPoolAllocator().allocate(length + 1));
+    memcpy(copy, s, length + 1);
+
+    size_t slot = ProbeSlots(slots, hash, IsEmptyAtomSlot, NoMatch());
+    atom = firstAtom + (int)strings.size();
+    strings.push_back(copy);
+    slots[slot] = atom;
+
+    return atom;
+}
+
+int TStringAtomMap::find(const char* s, unsigned int hash) const
+{
+    int atom = GetGlobalAtoms().find(s, hash);
+    if (atom != 0 || slots.empty())
+        return atom;
 
-    nextAtom = PpAtomLast;
+    size_t slot;
+    return FindAtom(strings, firstAtom, slots, s, hash, slot);
 }
 
 } // end namespace glslang
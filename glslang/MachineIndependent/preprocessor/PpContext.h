@@ -79,7 +79,8 @@ NVIDIA HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef PPCONTEXT_H
 #define PPCONTEXT_H
 
-#include <stack>
+#include <memory>
+#include <vector>
 #include <unordered_map>
 #include <sstream>
 
@@ -134,53 +135,97 @@ class TStringAtomMap {
 // Maintain a bi-directional mapping between relevant preprocessor strings and
 // "atoms" which a unique integers (small, contiguous, not hash-like) per string.
 //
+// The fixed atoms, and the names nearly every shader defines, like the macros of
+// the preamble, are in a process-wide table made once and never changed, so all
+// shaders read it without locking.  Other strings get atoms in a per-shader table
+// layered over it.  Both are open-addressed hash tables, so a lookup allocates
+// nothing.
+//
 public:
     TStringAtomMap();
 
     // Map string -> atom.
     // Return 0 if no existing string.
-    int getAtom(const char* s) const
-    {
-        auto it = atomMap.find(s);
-        return it == atomMap.end() ? 0 : it->second;
-    }
+    int getAtom(const char* s) const;
 
     // Map a new or existing string -> atom, inventing a new atom if necessary.
-    int getAddAtom(const char* s)
-    {
-        int atom = getAtom(s);
-        if (atom == 0) {
-            atom = nextAtom++;
-            addAtomFixed(s, atom);
-        }
-        return atom;
-    }
+    int getAddAtom(const char* s);
 
     // Map atom -> string.
-    const char* getString(int atom) const { return stringMap[atom]->c_str(); }
+    const char* getString(int atom) const
+    {
+        return atom < firstAtom ? globalStrings[atom] : strings[atom - firstAtom];
+    }
 
 protected:
     TStringAtomMap(TStringAtomMap&);
     TStringAtomMap& operator=(TStringAtomMap&);
 
-    TUnorderedMap<TString, int> atomMap;
-    TVector<const TString*> stringMap;    // these point into the TString in atomMap
-    int nextAtom;
+    int find(const char* s, unsigned int hash) const;
+
+    const char* const* globalStrings;   // atom -> string, for the atoms of the process-wide table
+    int firstAtom;                      // the first atom of this table, after those of the process-wide table
+    TVector<const char*> strings;       // atom - firstAtom -> string
+    TVector<int> slots;                 // hash table of this table's atoms; 0 is an empty slot
+};
 
-    // Bad source characters can lead to bad atoms, so gracefully handle those by
-    // pre-filling the table with them (to avoid if tests later).
-    TString badToken;
+//
+// Implementation is in PpTokens.cpp
+//
+// The tokens scanned from the text of an #included file, recorded by the first
+// include of it, for later includes of the same text, in this or other shaders,
+// to replay; see TIncludeCache.  Tokens are found by where their scan started in
+// the text, so text read a character at a time instead (like the header name of
+// a nested #include), and tokens not recorded because their scan depended on
+// more than the text, are simply scanned again.
+//
+class TIncludeTokens {
+public:
+    TIncludeTokens(const char* text, size_t length, EShSource source) : text(text, length), source(source) { }
 
-    // Add bi-directional mappings:
-    //  - string -> atom
-    //  - atom -> string
-    void addAtomFixed(const char* s, int atom)
+    bool matches(const char* otherText, size_t length, EShSource otherSource) const
     {
-        auto it = atomMap.insert(std::pair<TString, int>(s, atom)).first;
-        if (stringMap.size() < (size_t)atom + 1)
-            stringMap.resize(atom + 100, &badToken);
-        stringMap[atom] = &it->first;
+        return source == otherSource && text.size() == length && memcmp(text.data(), otherText, length) == 0;
     }
+
+    // One scan, from where it started to where it left the scanner, and its result.
+    struct Token {
+        size_t start;            // offset in the text of where the scan started
+        size_t length;           // characters scanned, including white space and comments
+        int locNewlines;         // newlines scanned before the token, and the column
+        int locColumn;           //   of the token: its location
+        int newlines;            // newlines scanned in all, and the column the
+        int column;              //   scanner was left at
+        int atom;
+        bool space;
+        long long i64val;
+        size_t nameOffset;       // of the token's text in 'names'
+        int nameLength;          // -1 when the scan did not set a name
+    };
+
+    // The token whose scan started at 'start', if recorded; 'next' is the index
+    // of where to look first, kept up to date for the scan following this one.
+    const Token* find(size_t start, size_t& next) const;
+
+    void add(const Token& token, const char* name)
+    {
+        tokens.push_back(token);
+        if (token.nameLength > 0) {
+            tokens.back().nameOffset = names.size();
+            names.append(name, token.nameLength);
+        }
+    }
+
+    const char* getName(const Token& token) const { return names.data() + token.nameOffset; }
+
+protected:
+    TIncludeTokens(TIncludeTokens&);
+    TIncludeTokens& operator=(TIncludeTokens&);
+
+    const std::string text;     // to check later includes against
+    const EShSource source;     // scanning some literals depends on the source language
+    std::vector<Token> tokens;  // in the order of their starts
+    std::string names;
 };
 
 class TInputScanner;
@@ -217,6 +262,7 @@ public:
         virtual bool peekContinuedPasting(int) { return false; } // true when non-spaced tokens can paste
         virtual bool endOfReplacementList() { return false; } // true when at the end of a macro replacement list (RHS of #define)
         virtual bool isMacroInput() { return false; }
+        virtual bool isIncludeFile() { return false; }
 
         // Will be called when we start reading tokens from this instance
         virtual void notifyActivated() {}
@@ -249,20 +295,25 @@ public:
     class TokenStream {
     public:
         // Manage a stream of these 'Token', which capture the relevant parts
-        // of a TPpToken, plus its atom.
+        // of a TPpToken, plus its atom.  The text of the token is not held by
+        // the token itself, but kept in the stream's shared name buffer, so
+        // recording a token allocates nothing per token and playing one back
+        // is a single copy of known length.
         class Token {
         public:
-            Token(int atom, const TPpToken& ppToken) : 
+            Token(int atom, const TPpToken& ppToken, size_t nameOffset, size_t nameLength) :
                 atom(atom),
-                space(ppToken.space),
+                nameOffset((unsigned int)nameOffset),
                 i64val(ppToken.i64val),
-                name(ppToken.name) { }
-            int get(TPpToken& ppToken)
+                nameLength((unsigned short)nameLength),
+                space(ppToken.space) { }
+            int get(TPpToken& ppToken, const char* names) const
             {
-                ppToken.clear();
                 ppToken.space = space;
                 ppToken.i64val = i64val;
-                snprintf(ppToken.name, sizeof(ppToken.name), "%s", name.c_str());
+                if (nameLength > 0)
+                    memcpy(ppToken.name, names + nameOffset, nameLength);
+                ppToken.name[nameLength] = 0;
                 return atom;
             }
             bool isAtom(int a) const { return atom == a; }
@@ -271,9 +322,10 @@ public:
         protected:
             Token() {}
             int atom;
-            bool space;        // did a space precede the token?
+            unsigned int nameOffset;     // of the token's text in the stream's name buffer
             long long i64val;
-            TString name;
+            unsigned short nameLength;   // at most MaxTokenLength
+            bool space;                  // did a space precede the token?
         };
 
         TokenStream() : currentPos(0) { }
@@ -317,6 +369,7 @@ public:
 
     protected:
         TVector<Token> stream;
+        TVector<char> names;    // the text of all the tokens in the stream, back to back
         size_t currentPos;
     };
 
@@ -469,6 +522,10 @@ protected:
     int CPPextension(TPpToken * ppToken);
     int readCPPline(TPpToken * ppToken);
     int scanHeaderName(TPpToken* ppToken, char delimit);
+    void includeGuardIfndef(int atom);
+    void includeGuardElse();
+    void includeGuardEndif();
+    bool includeIsGuarded(const std::string& headerName);
     TokenStream* PrescanMacroArg(TokenStream&, TPpToken*, bool newLineOkay);
     MacroExpandResult MacroExpand(TPpToken* ppToken, bool expandUndef, bool newLineOkay);
 
@@ -591,19 +648,39 @@ protected:
     public:
         // Copies prologue and epilogue. The includedFile must remain valid
         // until this TokenizableIncludeFile is no longer used.
+        // With a cache, the included file's tokens are replayed from it, or
+        // recorded for it if it has no recording of this file.
         TokenizableIncludeFile(const TSourceLoc& startLoc,
                           const std::string& prologue,
                           TShader::Includer::IncludeResult* includedFile,
                           const std::string& epilogue,
-                          TPpContext* pp)
+                          TPpContext* pp,
+                          TIncludeCache* cache = nullptr)
             : tInput(pp),
               prologue_(prologue),
               epilogue_(epilogue),
               includedFile_(includedFile),
               scanner(3, strings, lengths, nullptr, 0, 0, true),
               prevScanner(nullptr),
-              stringInput(pp, scanner)
+              stringInput(pp, scanner),
+              cache(cache),
+              nextToken(0),
+              significantTokens(0),
+              guardMacro(0),
+              guardDepth(0),
+              guardEnd(-1),
+              guardBroken(false),
+              errors(pp->parseContext.getNumErrors())
         {
+              if (cache != nullptr) {
+                  replay = cache->find(includedFile->headerName, includedFile->headerData,
+                                       includedFile->headerLength, pp->parseContext.intermediate.getSource());
+                  if (replay == nullptr)
+                      recording = std::make_shared<TIncludeTokens>(includedFile->headerData,
+                                                                   includedFile->headerLength,
+                                                                   pp->parseContext.intermediate.getSource());
+              }
+
               strings[0] = prologue_.data();
               strings[1] = includedFile_->headerData;
               strings[2] = epilogue_.data();
@@ -621,7 +698,8 @@ protected:
         }
 
         // tInput methods:
-        int scan(TPpToken* t) override { return stringInput.scan(t); }
+        int scan(TPpToken* t) override;
+        bool isIncludeFile() override { return true; }
         int getch() override { return stringInput.getch(); }
         void ungetch() override { stringInput.ungetch(); }
 
@@ -634,13 +712,37 @@ protected:
 
         void notifyDeleted() override
         {
+            if (recording != nullptr)
+                cache->add(includedFile_->headerName, recording);
+            if (guardMacro != 0 && ! guardBroken && guardEnd == significantTokens &&
+                pp->parseContext.getNumErrors() == errors)
+                pp->includeGuards[includedFile_->headerName] = guardMacro;
             pp->parseContext.setScanner(prevScanner);
             pp->pop_include();
         }
 
+        // Recognizing a classic include guard: an #ifndef, first thing in the
+        // file, whose #endif is the last thing in it, with no #else or #elif.
+        // Everything but newlines counts as a thing.
+        void guardIfndef(int atom, int depth)
+        {
+            if (significantTokens == 3) {   // '#', "ifndef", and the macro
+                guardMacro = atom;
+                guardDepth = depth;
+            }
+        }
+        void guardElse(int depth) { guardBroken = guardBroken || depth == guardDepth; }
+        void guardEndif(int depth)
+        {
+            if (depth == guardDepth - 1 && guardEnd < 0)
+                guardEnd = significantTokens;
+        }
+
     private:
         TokenizableIncludeFile& operator=(const TokenizableIncludeFile&);
 
+        int scanText(TPpToken*);
+
         // Stores the prologue for this string.
         const std::string prologue_;
 
@@ -664,6 +766,18 @@ protected:
         TInputScanner* prevScanner;
         // Delegate object implementing the tInput interface.
         tStringInput stringInput;
+        // Where to replay the included file from, or record it for.
+        TIncludeCache* cache;
+        std::shared_ptr<const TIncludeTokens> replay;
+        std::shared_ptr<TIncludeTokens> recording;
+        size_t nextToken;    // where in 'replay' to look first for the next token
+        // What is known about the file's include guard.
+        int significantTokens;  // scanned from the file's own text, but for newlines
+        int guardMacro;         // atom of the macro of a leading #ifndef, or 0
+        int guardDepth;         // #if nesting inside that #ifndef
+        int guardEnd;           // significant tokens through its #endif, or -1
+        bool guardBroken;       // by an #else or #elif of that #ifndef
+        int errors;             // errors before the file was included
     };
 
     int ScanFromString(char* s);
@@ -674,26 +788,32 @@ protected:
     void push_include(TShader::Includer::IncludeResult* result)
     {
         currentSourceFile = result->headerName;
-        includeStack.push(result);
+        includeStack.push_back(result);
     }
 
     void pop_include()
     {
-        TShader::Includer::IncludeResult* include = includeStack.top();
-        includeStack.pop();
+        TShader::Includer::IncludeResult* include = includeStack.back();
+        includeStack.pop_back();
         includer.releaseInclude(include);
         if (includeStack.empty()) {
             currentSourceFile = rootFileName;
         } else {
-            currentSourceFile = includeStack.top()->headerName;
+            currentSourceFile = includeStack.back()->headerName;
         }
     }
 
     bool inComment;
     std::string rootFileName;
-    std::stack<TShader::Includer::IncludeResult*> includeStack;
+    std::vector<TShader::Includer::IncludeResult*> includeStack;
     std::string currentSourceFile;
 
+    // For skipping includes of headers that would now be empty: what each
+    // #include, from where it was, resolved to; and the include guard macro of
+    // each resolved header that has one, or 0 for one with #pragma once.
+    std::unordered_map<std::string, std::string> resolvedIncludes;
+    std::unordered_map<std::string, int> includeGuards;
+
     std::istringstream strtodStream;
     bool disableEscapeSequences;
 };
@@ -468,13 +468,13 @@ int TPpContext::tStringInput::scan(TPpToken* ppToken)
                                                                      ch == 'f' || ch == 'F' ||
                                                                      ch == 'h' || ch == 'H'; };
 
-    static const char* const Int64_Extensions[] = {
+    static const TExtension Int64_Extensions[] = {
         E_GL_ARB_gpu_shader_int64,
         E_GL_EXT_shader_explicit_arithmetic_types,
         E_GL_EXT_shader_explicit_arithmetic_types_int64 };
     static const int Num_Int64_Extensions = sizeof(Int64_Extensions) / sizeof(Int64_Extensions[0]);
 
-    static const char* const Int16_Extensions[] = {
+    static const TExtension Int16_Extensions[] = {
         E_GL_AMD_gpu_shader_int16,
         E_GL_EXT_shader_explicit_arithmetic_types,
         E_GL_EXT_shader_explicit_arithmetic_types_int16 };
@@ -487,6 +487,7 @@ int TPpContext::tStringInput::scan(TPpToken* ppToken)
     for (;;) {
         while (ch == ' ' || ch == '\t') {
             ppToken->space = true;
+            input->getSpaces();
             ch = getch();
         }
 
@@ -512,16 +513,24 @@ int TPpContext::tStringInput::scan(TPpToken* ppToken)
         case 'u': case 'v': case 'w': case 'x': case 'y':
         case 'z':
             do {
-                if (len < MaxTokenLength) {
-                    ppToken->name[len++] = (char)ch;
-                    ch = getch();
-                } else {
+                // take the rest of the name in this string in bulk, leaving getch() to
+                // handle line continuations and the next string
+                size_t runLength;
+                const char* run = input->getIdentifierText(runLength);
+                size_t nameLength = 1 + runLength;
+                if (len + nameLength > MaxTokenLength) {
+                    nameLength = MaxTokenLength - len;
                     if (! AlreadyComplained) {
                         pp->parseContext.ppError(ppToken->loc, "name too long", "", "");
                         AlreadyComplained = 1;
                     }
-                    ch = getch();
                 }
+                if (nameLength > 0) {
+                    ppToken->name[len++] = (char)ch;
+                    memcpy(&ppToken->name[len], run, nameLength - 1);
+                    len += (int)nameLength - 1;
+                }
+                ch = getch();
             } while ((ch >= 'a' && ch <= 'z') ||
                      (ch >= 'A' && ch <= 'Z') ||
                      (ch >= '0' && ch <= '9') ||
@@ -991,6 +1000,7 @@ int TPpContext::tStringInput::scan(TPpToken* ppToken)
             if (ch == '/') {
                 pp->inComment = true;
                 do {
+                    input->getLineCommentText();
                     ch = getch();
                 } while (ch != '\n' && ch != EndOfInput);
                 ppToken->space = true;
@@ -1005,6 +1015,7 @@ int TPpContext::tStringInput::scan(TPpToken* ppToken)
                             pp->parseContext.ppError(ppToken->loc, "End of input in comment", "comment", "");
                             return ch;
                         }
+                        input->getBlockCommentText();
                         ch = getch();
                     }
                     ch = getch();
@@ -89,13 +89,17 @@ NVIDIA HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define snprintf sprintf_s
 #endif
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
 #include <cctype>
+#include <mutex>
+#include <unordered_map>
 
 #include "PpContext.h"
 #include "PpTokens.h"
+#include "../Scan.h"
 
 namespace glslang {
 
@@ -103,8 +107,9 @@ namespace glslang {
 // token stream, for later playback.
 void TPpContext::TokenStream::putToken(int atom, TPpToken* ppToken)
 {
-    TokenStream::Token streamToken(atom, *ppToken);
-    stream.push_back(streamToken);
+    size_t nameLength = strnlen(ppToken->name, MaxTokenLength);
+    stream.push_back(Token(atom, *ppToken, names.size(), nameLength));
+    names.insert(names.end(), ppToken->name, ppToken->name + nameLength);
 }
 
 // Read the next token from a macro token stream.
@@ -113,7 +118,7 @@ int TPpContext::TokenStream::getToken(TParseContextBase& parseContext, TPpToken
     if (atEnd())
         return EndOfInput;
 
-    int atom = stream[currentPos++].get(*ppToken);
+    int atom = stream[currentPos++].get(*ppToken, names.data());
     ppToken->loc = parseContext.getCurrentLoc();
 
 #ifndef GLSLANG_WEB
@@ -218,4 +223,187 @@ void TPpContext::UngetToken(int token, TPpToken* ppToken)
     pushInput(new tUngotTokenInput(this, token, ppToken));
 }
 
+namespace {
+
+// Whether a scan depended on no more than the text it scanned, and so can be
+// replayed by any later include of the same text: not when it was diagnosed,
+// nor when it went through a line continuation, which is checked against the
+// version, nor when it scanned a literal whose suffix is checked against the
+// version and extensions in effect (the check runs for an 'l' or 'h' suffix on
+// a float even when the suffix ends up not being part of it).
+bool IsReplayable(int atom, const TPpToken& ppToken, const char* scanned, size_t length, int following)
+{
+    if (memchr(scanned, '\\', length) != nullptr || following == '\\')
+        return false;
+
+    switch (atom) {
+    case PpAtomConstInt16:
+    case PpAtomConstUint16:
+    case PpAtomConstInt64:
+    case PpAtomConstUint64:
+    case PpAtomConstDouble:
+    case PpAtomConstFloat16:
+        return false;
+    case PpAtomConstFloat:
+    {
+        size_t nameLength = strlen(ppToken.name);
+        if (nameLength > 0 && (ppToken.name[nameLength - 1] == 'f' || ppToken.name[nameLength - 1] == 'F'))
+            return false;
+        return following != 'l' && following != 'L' && following != 'h' && following != 'H';
+    }
+    default:
+        return true;
+    }
+}
+
+// Whether the scan for a token of the given atom sets the token's name, which is
+// otherwise left as it was.
+bool SetsName(int atom)
+{
+    switch (atom) {
+    case PpAtomIdentifier:
+    case PpAtomConstString:
+    case PpAtomConstInt:
+    case PpAtomConstUint:
+    case PpAtomConstInt16:
+    case PpAtomConstUint16:
+    case PpAtomConstInt64:
+    case PpAtomConstUint64:
+    case PpAtomConstFloat:
+    case PpAtomConstDouble:
+    case PpAtomConstFloat16:
+    case '\'':
+        return true;
+    default:
+        return false;
+    }
+}
+
+} // end anonymous namespace
+
+const TIncludeTokens::Token* TIncludeTokens::find(size_t start, size_t& next) const
+{
+    if (next >= tokens.size() || tokens[next].start != start) {
+        // not simply the next one, as when text was read a character at a time
+        next = std::lower_bound(tokens.begin(), tokens.end(), start,
+                                [](const Token& token, size_t s) { return token.start < s; }) - tokens.begin();
+        if (next >= tokens.size() || tokens[next].start != start)
+            return nullptr;
+    }
+
+    return &tokens[next++];
+}
+
+int TPpContext::TokenizableIncludeFile::scan(TPpToken* ppToken)
+{
+    const bool inText = scanner.getCurrentSource() == 1;
+    int atom = scanText(ppToken);
+    if (inText && atom != '\n' && atom != EndOfInput)
+        ++significantTokens;
+
+    return atom;
+}
+
+// Scan the next token of the included file: replay it, if an earlier include of
+// the same text recorded its scan, or else scan it from the text, recording it
+// if this include is the one recording.  Only scans within the file's own text
+// are replayed or recorded, not those of the prologue and epilogue.
+int TPpContext::TokenizableIncludeFile::scanText(TPpToken* ppToken)
+{
+    if (scanner.getCurrentSource() != 1 || (replay == nullptr && recording == nullptr))
+        return stringInput.scan(ppToken);
+
+    const size_t start = scanner.getCurrentChar();
+
+    if (replay != nullptr) {
+        const TIncludeTokens::Token* token = replay->find(start, nextToken);
+        if (token == nullptr)
+            return stringInput.scan(ppToken);
+
+        ppToken->loc = pp->parseContext.getCurrentLoc();
+        ppToken->loc.line += token->locNewlines;
+        ppToken->loc.column = token->locColumn;
+        scanner.skipInString(token->length, token->newlines, token->column);
+        ppToken->space = token->space;
+        ppToken->i64val = token->i64val;
+        if (token->nameLength >= 0) {
+            memcpy(ppToken->name, replay->getName(*token), token->nameLength);
+            ppToken->name[token->nameLength] = 0;
+        }
+
+        return token->atom;
+    }
+
+    const int line = scanner.getSourceLoc().line;
+    const int errors = pp->parseContext.getNumErrors();
+    int atom = stringInput.scan(ppToken);
+
+    if (scanner.getCurrentSource() == 1 && pp->parseContext.getNumErrors() == errors) {
+        const size_t end = scanner.getCurrentChar();
+        const char* text = includedFile_->headerData;
+        if (IsReplayable(atom, *ppToken, text + start, end - start, (unsigned char)text[end])) {
+            TIncludeTokens::Token token;
+            token.start = start;
+            token.length = end - start;
+            token.locNewlines = ppToken->loc.line - line;
+            token.locColumn = ppToken->loc.column;
+            token.newlines = scanner.getSourceLoc().line - line;
+            token.column = scanner.getSourceLoc().column;
+            token.atom = atom;
+            token.space = ppToken->space;
+            token.i64val = ppToken->i64val;
+            token.nameOffset = 0;
+            token.nameLength = SetsName(atom) ? (int)strlen(ppToken->name) : -1;
+            recording->add(token, ppToken->name);
+        }
+    }
+
+    return atom;
+}
+
+struct TIncludeCache::TIncludes {
+    std::mutex mutex;
+    std::unordered_map<std::string, std::shared_ptr<const TIncludeTokens>> tokens;
+};
+
+TIncludeCache::TIncludeCache() : includes(new TIncludes) { }
+
+TIncludeCache::~TIncludeCache()
+{
+    delete includes;
+}
+
+void TIncludeCache::clear()
+{
+    std::lock_guard<std::mutex> guard(includes->mutex);
+    includes->tokens.clear();
+}
+
+int TIncludeCache::getNumIncludes() const
+{
+    std::lock_guard<std::mutex> guard(includes->mutex);
+    return (int)includes->tokens.size();
+}
+
+std::shared_ptr<const TIncludeTokens> TIncludeCache::find(const std::string& headerName, const char* headerData,
+                                                          size_t headerLength, EShSource source) const
+{
+    std::shared_ptr<const TIncludeTokens> tokens;
+    {
+        std::lock_guard<std::mutex> guard(includes->mutex);
+        auto it = includes->tokens.find(headerName);
+        if (it == includes->tokens.end())
+            return nullptr;
+        tokens = it->second;
+    }
+
+    return tokens->matches(headerData, headerLength, source) ? tokens : nullptr;
+}
+
+void TIncludeCache::add(const std::string& headerName, std::shared_ptr<const TIncludeTokens> tokens)
+{
+    std::lock_guard<std::mutex> guard(includes->mutex);
+    includes->tokens[headerName] = std::move(tokens);
+}
+
 } // end namespace glslang
@@ -1216,6 +1216,18 @@ bool TReflection::addStage(EShLanguage stage, const TIntermediate& intermediate)
     return true;
 }
 
+void TReflection::copyTypes()
+{
+    TMapIndexToReflection* maps[] = { &indexToUniform, &indexToUniformBlock, &indexToBufferVariable,
+                                      &indexToBufferBlock, &indexToPipeInput, &indexToPipeOutput };
+    for (TMapIndexToReflection* map : maps) {
+        for (TObjectReflection& object : *map) {
+            if (object.type != nullptr)
+                object.type = object.type->clone();
+        }
+    }
+}
+
 void TReflection::dump()
 {
     printf("Uniform reflection:\n");
@@ -171,6 +171,10 @@ public:
 
     void dump();
 
+    // Make copies of the types the reflection refers to, in the current pool,
+    // for the pool holding the originals to be freed.
+    void copyTypes();
+
 protected:
     friend class glslang::TReflectionTraverser;
 
@@ -43,8 +43,12 @@
 #include <assert.h>
 #include <errno.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <cstdio>
 #include <sys/time.h>
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
 
 #if !defined(__Fuchsia__)
 #include <sys/resource.h>
@@ -204,4 +208,21 @@ void OS_DumpMemoryCounters()
 #endif
 }
 
+void* OS_AllocHugePageArena(size_t size)
+{
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    void* arena = nullptr;
+    if (posix_memalign(&arena, size, size) != 0)
+        return nullptr;
+
+    // only advice; the kernel backs the arena with regular pages if it must
+    madvise(arena, size, MADV_HUGEPAGE);
+
+    return arena;
+#else
+    (void)size;
+    return nullptr;
+#endif
+}
+
 } // end namespace glslang
@@ -144,4 +144,10 @@ void OS_DumpMemoryCounters()
 #endif
 }
 
+void* OS_AllocHugePageArena(size_t)
+{
+    // Large pages need the SeLockMemoryPrivilege, which processes normally lack.
+    return nullptr;
+}
+
 } // namespace glslang
@@ -35,6 +35,8 @@
 #ifndef __OSINCLUDE_H
 #define __OSINCLUDE_H
 
+#include <cstddef>
+
 namespace glslang {
 
 //
@@ -58,6 +60,10 @@ void OS_CleanupThreadData(void);
 
 void OS_DumpMemoryCounters();
 
+// Allocate 'size' bytes, aligned to 'size', asking for them to be backed by huge
+// pages.  Returns nullptr where that is not supported.  The memory is never freed.
+void* OS_AllocHugePageArena(size_t size);
+
 } // end namespace glslang
 
 #endif // __OSINCLUDE_H
@@ -70,6 +70,10 @@
 // It should increment by one when new functionality is added.
 #define GLSLANG_MINOR_VERSION 14
 
+// The major part of the version, which is also the low-order part of the SPIR-V
+// generator's magic number; see GetSpirvGeneratorVersion() for when to bump it.
+#define GLSLANG_SPIRV_GENERATOR_VERSION 8
+
 //
 // Call before doing any other compiler/linker operations.
 //
@@ -382,6 +386,7 @@ SH_IMPORT_EXPORT int ShGetUniformLocation(const ShHandle uniformMap, const char*
 //
 
 #include <list>
+#include <memory>
 #include <string>
 #include <utility>
 
@@ -404,6 +409,142 @@ bool InitializeProcess();
 // Call once per process to tear down everything
 void FinalizeProcess();
 
+#ifndef GLSLANG_WEB
+// Describes the built-in symbols needed by a kind of shader, in terms of how
+// such shaders will be parsed, for PrewarmBuiltins() to set up ahead of time.
+struct TBuiltinConfiguration {
+    TBuiltinConfiguration() : stage(EShLangVertex), version(110), profile(ENoProfile), messages(EShMsgDefault),
+                              resources(nullptr), milliseconds(0.0)
+    {
+        environment.input.languageFamily = EShSourceNone;
+        environment.input.dialect = EShClientNone;
+        environment.client.client = EShClientNone;
+        environment.target.language = EShTargetNone;
+        environment.target.hlslFunctionality1 = false;
+    }
+
+    EShLanguage stage;
+    int version;               // the shaders' #version, or the default version given to TShader::parse()
+    EProfile profile;          // the shaders' profile, or ENoProfile to deduce it from 'version'
+    EShMessages messages;      // as given to TShader::parse(); EShMsgSpvRules, EShMsgVulkanRules and
+                               // EShMsgReadHlsl select the built-ins
+    TEnvironment environment;  // as set by TShader::setEnv*()
+    const TBuiltInResource* resources;  // as given to TShader::parse(), to also set up the built-ins that
+                                        // depend on them; nullptr to only set up the others
+
+    double milliseconds;       // output: time taken to set up this configuration's built-ins, including
+                               // waiting on another configuration that needs the same ones; near 0
+                               // if they were already set up
+};
+
+// Set up the built-in symbol tables for the given configurations, so that later
+// compiles of such shaders don't pay for it.  Configurations are worked on in
+// parallel, by up to 'threads' new threads; 0 means one per hardware thread.
+// Call after InitializeProcess().  Returns false if a configuration had an
+// invalid version or profile, though it still set up the built-ins a compile
+// of it would use.
+bool PrewarmBuiltins(TBuiltinConfiguration* configurations, int count, int threads = 0);
+
+// Optionally, name a directory for caching the generated built-in symbol tables
+// across processes.  Tables are loaded from snapshot files found there instead of
+// being generated, and newly generated tables are saved there.  Snapshots from a
+// different glslang build are detected and ignored.  Pass nullptr or "" to stop
+// using snapshots.  Call after InitializeProcess(), before compiling shaders.
+void SetBuiltinSnapshotDirectory(const char* directory);
+
+// A snapshot of built-in symbol tables held in memory, like those made at build
+// time by the builtin-table-gen tool.
+struct TBuiltinSnapshot {
+    const char* name;            // the name of the snapshot's file in a snapshot directory
+    const unsigned char* data;
+    size_t size;
+};
+
+// Optionally, give snapshots in memory for built-in symbol tables to be loaded
+// from, ahead of any snapshot directory.  The snapshots' contents must stay
+// valid until FinalizeProcess(); snapshots from a different glslang build are
+// ignored.  Call after InitializeProcess(), before compiling shaders.
+void SetBuiltinSnapshots(const TBuiltinSnapshot* snapshots, int count);
+#endif
+
+// Process-wide statistics of the pool allocators that hold compile-time memory.
+struct TPoolStatistics {
+    size_t pagesLive;            // pages held by pools
+    size_t pagesCached;          // freed pages kept for reuse by later pools
+    size_t bytesAllocated;       // bytes handed out by pools, in total, so far
+};
+
+void GetPoolStatistics(TPoolStatistics& statistics);
+
+// Optionally, change how much memory (default 4 MB) each thread keeps, from the
+// pools of finished compiles, for reuse by later compiles.  0 returns all freed
+// memory to the system.
+void SetPoolPageCacheLimit(size_t bytes);
+
+// Optionally, back pool memory with huge pages where the OS supports it, to
+// lower TLB pressure in long-running compile services.  Memory taken this way is
+// reused, but only returned to the system when the process exits.
+void SetPoolHugePages(bool hugePages);
+
+// Memory held by a TShader or TProgram, by what it is for, in bytes.
+struct TMemoryUsage {
+    size_t current;
+    size_t peak;
+};
+
+struct TMemoryStats {
+    TMemoryUsage poolPages;      // pages taken from the OS for all of the below but SPIR-V
+    TMemoryUsage ast;            // AST nodes, types, and anything else not below
+    TMemoryUsage symbolTable;    // symbol-table levels, their entries, and symbols copied into them
+    TMemoryUsage strings;        // contents of names and other strings
+    TMemoryUsage spirv;          // IR of the last GlslangToSpv() of each intermediate, freed when it returns:
+                                 // its peak while built, and current as of when it was done
+};
+
+// Calls to built-in functions a GLSL parse resolved, and how many of those
+// reused the resolution of an earlier call of the same signature.
+struct TResolutionStats {
+    int builtInCalls;
+    int reusedBuiltInCalls;
+};
+
+class TIncludeTokens;
+
+// An optional cache of the tokenized form of #included files, for
+// TShader::setIncludeCache().  One cache can be shared by any number of shaders,
+// compiled on any number of threads.  The first include of a header records the
+// tokens scanned from its text, and later includes of a header of the same
+// resolved name and contents replay them instead of scanning the text again.
+// Replay is below the preprocessor, so macros, #if and the rest of the
+// directives act on replayed tokens just as on scanned ones.
+class TIncludeCache {
+public:
+    TIncludeCache();
+    virtual ~TIncludeCache();
+
+    // Forget all recorded headers.  Compiles already replaying one keep it until
+    // they are done.
+    void clear();
+
+    // Number of headers recorded.
+    int getNumIncludes() const;
+
+    // Used by the preprocessor: find the recording of the given header, if its
+    // contents and source language are those recorded; and record a header,
+    // replacing any earlier recording of it.
+    std::shared_ptr<const TIncludeTokens> find(const std::string& headerName, const char* headerData,
+                                               size_t headerLength, EShSource) const;
+    void add(const std::string& headerName, std::shared_ptr<const TIncludeTokens>);
+
+protected:
+    struct TIncludes;
+    TIncludes* includes;
+
+private:
+    TIncludeCache(TIncludeCache&);
+    TIncludeCache& operator=(TIncludeCache&);
+};
+
 // Resource type for IO resolver
 enum TResourceType {
     EResSampler,
@@ -608,6 +749,51 @@ public:
         virtual void releaseInclude(IncludeResult*) override { }
     };
 
+#ifndef GLSLANG_WEB
+    // Optionally, replay #included files from, and record them into, 'cache',
+    // which can be shared with other shaders; nullptr stops using a cache.  The
+    // cache must outlive parsing this shader.
+    void setIncludeCache(TIncludeCache* cache);
+#endif
+
+    // A store of preprocess() results, kept by the application, possibly across
+    // runs, for setPreprocessCache().  Entries are keyed by a hash of everything
+    // preprocess() reads other than included files: the strings and their names,
+    // the preamble, the stage, the resources and the arguments.  An entry lists
+    // the Includer requests its preprocessing made, with a hash of each result;
+    // before an entry is used, the requests are made again and their results must
+    // hash the same.
+    class PreprocessCache {
+    public:
+        struct Include {
+            std::string headerName;         // as written in the #include
+            std::string includerName;
+            size_t inclusionDepth;
+            bool system;                    // includeSystem(), rather than includeLocal()
+            unsigned long long hash;        // of the result's resolved name and contents
+        };
+        struct Entry {
+            std::vector<Include> includes;  // in the order requested
+            std::string output;
+            std::string infoLog;
+            bool success;
+        };
+
+        // Fill in the entry stored for 'key', returning false if there is none.
+        virtual bool find(unsigned long long key, Entry&) = 0;
+        // Store an entry for 'key', replacing any earlier one.
+        virtual void store(unsigned long long key, const Entry&) = 0;
+        virtual ~PreprocessCache() {}
+    };
+
+#ifndef GLSLANG_WEB
+    // Optionally, let preprocess() return a result from 'cache' instead of
+    // preprocessing, and store what it preprocesses there; nullptr stops using a
+    // cache.  A cached result only reproduces the output string, the info log and
+    // the returned success.
+    void setPreprocessCache(PreprocessCache* cache) { preprocessCache = cache; }
+#endif
+
     bool parse(const TBuiltInResource*, int defaultVersion, EProfile defaultProfile, bool forceDefaultVersionAndProfile,
                bool forwardCompatible, EShMessages, Includer&);
 
@@ -642,11 +828,18 @@ public:
     EShLanguage getStage() const { return stage; }
     TIntermediate* getIntermediate() const { return intermediate; }
 
+    // Memory held for the shader's compile and intermediate.
+    void getMemoryStats(TMemoryStats&) const;
+
+    // Built-in call resolutions of the shader's parse.
+    void getResolutionStats(TResolutionStats&) const;
+
 protected:
     TPoolAllocator* pool;
     EShLanguage stage;
     TCompiler* compiler;
     TIntermediate* intermediate;
+    TMemoryUsage spirvMemory;    // recorded through the intermediate by the SPIR-V back end
     TInfoSink* infoSink;
     // strings and lengths follow the standard for glShaderSource:
     //     strings is an array of numStrings pointers to string data.
@@ -668,6 +861,8 @@ protected:
 
     TEnvironment environment;
 
+    PreprocessCache* preprocessCache;
+
     friend class TProgram;
 
 private:
@@ -703,6 +898,8 @@ public:
     EShLanguageMask stages;
 
 protected:
+    friend class TReflection;
+
     TObjectReflection()
         : offset(-1), glDefineType(-1), size(-1), index(-1), counterIndex(-1), numMembers(-1), arrayStride(0),
           topLevelArrayStride(0), stages(EShLanguageMask(0)), type(nullptr)
@@ -813,6 +1010,21 @@ public:
 
     TIntermediate* getIntermediate(EShLanguage stage) const { return intermediate[stage]; }
 
+    // Memory held for linking, and for SPIR-V generated from the program's
+    // intermediates.  Memory held by the shaders added is not included.
+    void getMemoryStats(TMemoryStats&) const;
+
+    // Optionally, once SPIR-V has been generated and any mapIO() and
+    // buildReflection() are done, free the intermediates and everything else
+    // the front end holds, in the program and in the shaders added to it.
+    // Reflection and info logs stay usable; the program's getIntermediate()
+    // returns nullptr afterward.  Each shader gets a new, empty intermediate,
+    // so its getIntermediate(), parse(), preprocess() and setters still work,
+    // but settings kept in the intermediate, like the entry point and binding
+    // shifts, are back to their defaults.  Like link(), leaves the program's
+    // pool as the thread's current pool.
+    void releaseIntermediates();
+
 #ifndef GLSLANG_WEB
 
     // Reflection Interface
@@ -916,6 +1128,7 @@ protected:
     std::list<TShader*> stages[EShLangCount];
     TIntermediate* intermediate[EShLangCount];
     bool newedIntermediate[EShLangCount];      // track which intermediate were "new" versus reusing a singleton unit in a stage
+    TMemoryUsage spirvMemory[EShLangCount];    // for the "new" intermediates, as for TShader
     TInfoSink* infoSink;
 #ifndef GLSLANG_WEB
     TReflection* reflection;
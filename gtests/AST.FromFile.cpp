@@ -135,6 +135,7 @@ INSTANTIATE_TEST_CASE_P(
         "constErrors.frag",
         "constFold.frag",
         "constFoldIntMin.frag",
+        "constFoldBatched.frag",
         "errors.frag",
         "forwardRef.frag",
         "uint.frag",
@@ -233,6 +234,7 @@ INSTANTIATE_TEST_CASE_P(
         "precise_struct_block.vert",
         "maxClipDistances.vert",
         "findFunction.frag",
+        "findFunctionReuse.frag",
         "constantUnaryConversion.comp",
         "glsl.450.subgroup.frag",
         "glsl.450.subgroup.geom",
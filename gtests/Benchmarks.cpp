@@ -0,0 +1,428 @@
+//
+// Copyright (C) 2020 The Khronos Group Inc.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//    Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+//    Redistributions in binary form must reproduce the above
+//    copyright notice, this list of conditions and the following
+//    disclaimer in the documentation and/or other materials provided
+//    with the distribution.
+//
+//    Neither the name of The Khronos Group Inc. nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+//
+// Startup and first-compile benchmarks.
+//
+// For each representative shader from the Test/ directory, in order, reports:
+//  - setup:   setting up the built-in symbol tables of its version and profile;
+//             near 0 when an earlier shader of the same version already did it
+//  - context: adding the built-ins that depend on the stage and resources
+//  - first:   the first compile of the shader, with the built-ins in place
+//  - warm:    the fastest of the following compiles
+// along with the time InitializeProcess() took, and the cost of a single pool
+// allocation, which dominates AST-heavy compiles, and of preprocessing a generated
+// macro-heavy shader, which is dominated by recording and replaying macro token
+// streams.  Results are written as JSON.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "StandAlone/ResourceLimits.h"
+#include "glslang/Include/PoolAlloc.h"
+#include "glslang/Public/ShaderLang.h"
+
+namespace {
+
+struct TBenchmarkShader {
+    const char* language;    // "GLSL", "ESSL" or "HLSL"
+    const char* fileName;    // in the test root directory
+    EShLanguage stage;
+    int version;             // as in the shader's #version, or the default version for HLSL
+    EProfile profile;
+    EShMessages messages;
+    const char* entryPoint;  // nullptr for "main"
+};
+
+const EShMessages OpenGlMessages = EShMsgSpvRules;
+const EShMessages VulkanMessages = (EShMessages)(EShMsgSpvRules | EShMsgVulkanRules);
+const EShMessages HlslMessages = (EShMessages)(EShMsgSpvRules | EShMsgVulkanRules | EShMsgReadHlsl);
+
+const TBenchmarkShader Shaders[] = {
+    { "ESSL", "100Limits.vert",       EShLangVertex,         100, ENoProfile,   EShMsgDefault,  nullptr },
+    { "ESSL", "spv.300layout.frag",   EShLangFragment,       310, EEsProfile,   EShMsgDefault,  nullptr },
+    { "ESSL", "spv.310.comp",         EShLangCompute,        310, EEsProfile,   EShMsgDefault,  nullptr },
+    { "GLSL", "spv.130.frag",         EShLangFragment,       140, ENoProfile,   EShMsgDefault,  nullptr },
+    { "GLSL", "spv.150.vert",         EShLangVertex,         150, ECoreProfile, EShMsgDefault,  nullptr },
+    { "GLSL", "410.vert",             EShLangVertex,         410, ECoreProfile, EShMsgDefault,  nullptr },
+    { "GLSL", "spv.400.tesc",         EShLangTessControl,    400, ECoreProfile, EShMsgDefault,  nullptr },
+    { "GLSL", "spv.450.geom",         EShLangGeometry,       450, ECoreProfile, VulkanMessages, nullptr },
+    { "GLSL", "spv.460.vert",         EShLangVertex,         460, ENoProfile,   VulkanMessages, nullptr },
+    { "GLSL", "spv.460.frag",         EShLangFragment,       460, ECoreProfile, OpenGlMessages, nullptr },
+    { "GLSL", "spv.460.comp",         EShLangCompute,        460, ENoProfile,   VulkanMessages, nullptr },
+#ifdef ENABLE_HLSL
+    { "HLSL", "hlsl.intrinsics.vert", EShLangVertex,         100, ENoProfile,   HlslMessages,   "VertexShaderFunction" },
+    { "HLSL", "hlsl.intrinsics.frag", EShLangFragment,       100, ENoProfile,   HlslMessages,   "PixelShaderFunction" },
+    { "HLSL", "hlsl.basic.comp",      EShLangCompute,        100, ENoProfile,   HlslMessages,   nullptr },
+#endif
+};
+
+const char* StageName(EShLanguage stage)
+{
+    switch (stage) {
+    case EShLangVertex:         return "vert";
+    case EShLangTessControl:    return "tesc";
+    case EShLangTessEvaluation: return "tese";
+    case EShLangGeometry:       return "geom";
+    case EShLangFragment:       return "frag";
+    case EShLangCompute:        return "comp";
+    default:                    return "unknown";
+    }
+}
+
+struct TBenchmarkResult {
+    const TBenchmarkShader* shader;
+    bool compiled;
+    double setupMilliseconds;
+    double contextMilliseconds;
+    double firstCompileMilliseconds;
+    double warmCompileMilliseconds;
+    glslang::TMemoryStats memory;   // of the first compile
+};
+
+double MillisecondsSince(std::chrono::steady_clock::time_point start)
+{
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    return elapsed.count();
+}
+
+bool ReadFile(const std::string& path, std::string& contents)
+{
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    if (! file)
+        return false;
+
+    std::ostringstream stream;
+    stream << file.rdbuf();
+    contents = stream.str();
+
+    return true;
+}
+
+// Compile (parse) the shader once, returning how long it took, and optionally
+// the memory it held and how it resolved built-in calls.
+double Compile(const TBenchmarkShader& shader, const std::string& source, bool& compiled,
+               glslang::TMemoryStats* memory = nullptr, glslang::TResolutionStats* resolutions = nullptr)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    glslang::TShader compile(shader.stage);
+    const char* text = source.c_str();
+    compile.setStrings(&text, 1);
+    if (shader.entryPoint != nullptr)
+        compile.setEntryPoint(shader.entryPoint);
+    compiled = compile.parse(&glslang::DefaultTBuiltInResource, shader.version, shader.profile, false, false,
+                             shader.messages);
+    double milliseconds = MillisecondsSince(start);
+
+    if (memory != nullptr)
+        compile.getMemoryStats(*memory);
+    if (resolutions != nullptr)
+        compile.getResolutionStats(*resolutions);
+
+    return milliseconds;
+}
+
+TBenchmarkResult Run(const TBenchmarkShader& shader, const std::string& source, int iterations)
+{
+    TBenchmarkResult result = {};
+    result.shader = &shader;
+
+    glslang::TBuiltinConfiguration configuration;
+    configuration.stage = shader.stage;
+    configuration.version = shader.version;
+    configuration.profile = shader.profile;
+    configuration.messages = shader.messages;
+
+    glslang::PrewarmBuiltins(&configuration, 1, 1);
+    result.setupMilliseconds = configuration.milliseconds;
+
+    configuration.resources = &glslang::DefaultTBuiltInResource;
+    glslang::PrewarmBuiltins(&configuration, 1, 1);
+    result.contextMilliseconds = configuration.milliseconds;
+
+    result.firstCompileMilliseconds = Compile(shader, source, result.compiled, &result.memory);
+
+    bool compiled;
+    for (int i = 0; i < iterations; ++i) {
+        double milliseconds = Compile(shader, source, compiled);
+        if (i == 0 || milliseconds < result.warmCompileMilliseconds)
+            result.warmCompileMilliseconds = milliseconds;
+    }
+
+    return result;
+}
+
+// Time allocating from the thread's current pool the way AST nodes and pool-based
+// containers do, each allocation finding the pool through GetThreadPoolAllocator().
+// Returns nanoseconds per allocation.
+double PoolAllocationNanoseconds()
+{
+    const int batches = 200;
+    const int batchSize = 10000;
+
+    glslang::TPoolAllocator pool;
+    glslang::SetThreadPoolAllocator(&pool);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int b = 0; b < batches; ++b) {
+        pool.push();
+        for (int a = 0; a < batchSize; ++a)
+            glslang::GetThreadPoolAllocator().allocate(48);
+        pool.pop();
+    }
+    double milliseconds = MillisecondsSince(start);
+
+    glslang::SetThreadPoolAllocator(nullptr);
+
+    return milliseconds * 1e6 / ((double)batches * batchSize);
+}
+
+// Generate a shader whose preprocessing is dominated by macro expansion: layers
+// of function-like macros, each expanding to several uses of the layer below,
+// with object-like macros and token pasting mixed in.
+std::string MacroHeavySource()
+{
+    const int layers = 6;
+    const int uses = 400;
+
+    std::ostringstream source;
+    source << "#version 450\n"
+              "#define SCALE 1.5\n"
+              "#define OFFSET vec4(0.25, 0.5, 0.75, 1.0)\n"
+              "#define CAT(a, b) a ## b\n"
+              "#define M0(x, y) ((x) * SCALE + (y) - OFFSET.w)\n";
+    for (int l = 1; l < layers; ++l)
+        source << "#define M" << l << "(x, y) (M" << l - 1 << "(x, y) + M" << l - 1 << "(y, x) * M"
+               << l - 1 << "(x, CAT(SCA, LE)))\n";
+    source << "layout(location = 0) out vec4 color;\n"
+              "void main()\n"
+              "{\n"
+              "    float v = 0.0;\n";
+    for (int u = 0; u < uses; ++u)
+        source << "    v += M" << layers - 1 << "(v, " << u << ".0);\n";
+    source << "    color = OFFSET * v;\n"
+              "}\n";
+
+    return source.str();
+}
+
+// Preprocess the macro-heavy shader, returning the fastest of the iterations.
+double PreprocessMilliseconds(const std::string& source, int iterations)
+{
+    double fastest = 0.0;
+    for (int i = 0; i < iterations; ++i) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        glslang::TShader shader(EShLangFragment);
+        const char* text = source.c_str();
+        shader.setStrings(&text, 1);
+        std::string output;
+        glslang::TShader::ForbidIncluder includer;
+        shader.preprocess(&glslang::DefaultTBuiltInResource, 450, ENoProfile, false, false, EShMsgDefault,
+                          &output, includer);
+
+        double milliseconds = MillisecondsSince(start);
+        if (i == 0 || milliseconds < fastest)
+            fastest = milliseconds;
+    }
+
+    return fastest;
+}
+
+// Generate a shader whose parsing is dominated by function calls: overloaded
+// user functions, and built-ins called with arguments needing conversions, so
+// calls are resolved through the overload candidates.
+std::string CallHeavySource()
+{
+    const int uses = 400;
+
+    std::ostringstream source;
+    source << "#version 450\n"
+              "struct S { vec4 a; ivec2 b; };\n"
+              "float f(float x, float y) { return x + y; }\n"
+              "vec2 f(vec2 x, vec2 y) { return x * y; }\n"
+              "vec3 f(vec3 x, vec3 y) { return x - y; }\n"
+              "vec4 f(vec4 x, vec4 y) { return x / y; }\n"
+              "vec4 f(S s, vec4 y) { return s.a + y; }\n"
+              "float g(mat4 m, vec4 v, int i) { return (m * v)[i]; }\n"
+              "layout(binding = 0) uniform sampler2D tex;\n"
+              "layout(location = 0) in vec2 uv;\n"
+              "layout(location = 0) out vec4 color;\n"
+              "void main()\n"
+              "{\n"
+              "    S s = S(vec4(1.0), ivec2(2));\n"
+              "    mat4 m = mat4(1.0);\n"
+              "    vec4 v = vec4(0.0);\n"
+              "    int i = 1;\n";
+    for (int u = 0; u < uses; ++u)
+        source << "    v += f(s, texture(tex, f(uv, vec2(" << u << "))));\n"
+                  "    v.x += f(max(v.y, 2), clamp(v.z, 0, 1)) + g(m, v, i) + dot(f(v.xyz, v.yzw), vec3(i));\n";
+    source << "    color = v;\n"
+              "}\n";
+
+    return source.str();
+}
+
+// Parse the call-heavy shader, returning the fastest of the iterations, and
+// the share of its built-in calls that reused an earlier resolution.
+double ParseMilliseconds(const std::string& source, int iterations, double& reusedResolutions)
+{
+    TBenchmarkShader shader = { "GLSL", "", EShLangFragment, 450, ENoProfile, EShMsgDefault, nullptr };
+    bool compiled;
+    glslang::TResolutionStats resolutions;
+    double fastest = Compile(shader, source, compiled, nullptr, &resolutions);
+    reusedResolutions = resolutions.builtInCalls > 0 ?
+                        (double)resolutions.reusedBuiltInCalls / resolutions.builtInCalls : 0.0;
+    for (int i = 0; i < iterations; ++i)
+        fastest = std::min(fastest, Compile(shader, source, compiled));
+
+    return fastest;
+}
+
+void WriteJson(FILE* out, double initializeMilliseconds, double poolAllocationNanoseconds,
+               double preprocessMilliseconds, double parseMilliseconds, double reusedResolutions,
+               int iterations, const std::vector<TBenchmarkResult>& results)
+{
+    fprintf(out, "{\n");
+    fprintf(out, "  \"initializeProcessMs\": %.4f,\n", initializeMilliseconds);
+    fprintf(out, "  \"poolAllocationNs\": %.4f,\n", poolAllocationNanoseconds);
+    fprintf(out, "  \"preprocessMacrosMs\": %.4f,\n", preprocessMilliseconds);
+    fprintf(out, "  \"parseCallsMs\": %.4f,\n", parseMilliseconds);
+    fprintf(out, "  \"parseCallsReusedResolutions\": %.4f,\n", reusedResolutions);
+    fprintf(out, "  \"warmIterations\": %d,\n", iterations);
+    fprintf(out, "  \"results\": [\n");
+    for (size_t r = 0; r < results.size(); ++r) {
+        const TBenchmarkResult& result = results[r];
+        fprintf(out, "    { \"language\": \"%s\", \"version\": %d, \"stage\": \"%s\", \"shader\": \"%s\", "
+                     "\"compiled\": %s, \"setupMs\": %.4f, \"contextMs\": %.4f, \"firstCompileMs\": %.4f, "
+                     "\"warmCompileMs\": %.4f, \"peakBytes\": { \"pages\": %zu, \"ast\": %zu, "
+                     "\"symbolTable\": %zu, \"strings\": %zu } }%s\n",
+                result.shader->language, result.shader->version, StageName(result.shader->stage),
+                result.shader->fileName, result.compiled ? "true" : "false", result.setupMilliseconds,
+                result.contextMilliseconds, result.firstCompileMilliseconds, result.warmCompileMilliseconds,
+                result.memory.poolPages.peak, result.memory.ast.peak, result.memory.symbolTable.peak,
+                result.memory.strings.peak, r + 1 < results.size() ? "," : "");
+    }
+    fprintf(out, "  ],\n");
+
+    glslang::TPoolStatistics pool;
+    glslang::GetPoolStatistics(pool);
+    fprintf(out, "  \"pool\": { \"pagesLive\": %zu, \"pagesCached\": %zu, \"bytesAllocated\": %zu }\n",
+            pool.pagesLive, pool.pagesCached, pool.bytesAllocated);
+    fprintf(out, "}\n");
+}
+
+void Usage()
+{
+    printf("Usage: glslangbenchmarks [options]\n"
+           "\n"
+           "Times InitializeProcess(), built-in symbol table set up, first and warm\n"
+           "compiles of representative shaders, pool allocation, preprocessing of a\n"
+           "macro-heavy shader, and parsing of a call-heavy shader, and writes the\n"
+           "results as JSON.\n"
+           "\n"
+           "  --test-root <dir>    directory holding the shaders (default: the Test/ directory)\n"
+           "  --iterations <n>     number of warm compiles to take the fastest of (default: 10)\n"
+           "  --output <file>      write the results to <file> instead of stdout\n");
+}
+
+} // end anonymous namespace
+
+int main(int argc, char* argv[])
+{
+    std::string testRoot = GLSLANG_TEST_DIRECTORY;
+    int iterations = 10;
+    const char* outputName = nullptr;
+    for (int a = 1; a < argc; ++a) {
+        std::string arg = argv[a];
+        if (arg == "--test-root" && a + 1 < argc)
+            testRoot = argv[++a];
+        else if (arg == "--iterations" && a + 1 < argc)
+            iterations = std::max(1, atoi(argv[++a]));
+        else if (arg == "--output" && a + 1 < argc)
+            outputName = argv[++a];
+        else {
+            Usage();
+            return arg == "--help" ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    std::vector<std::string> sources;
+    for (const TBenchmarkShader& shader : Shaders) {
+        std::string source;
+        if (! ReadFile(testRoot + "/" + shader.fileName, source)) {
+            fprintf(stderr, "glslangbenchmarks: cannot read %s/%s\n", testRoot.c_str(), shader.fileName);
+            return EXIT_FAILURE;
+        }
+        sources.push_back(source);
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    glslang::InitializeProcess();
+    double initializeMilliseconds = MillisecondsSince(start);
+
+    double poolAllocationNanoseconds = PoolAllocationNanoseconds();
+
+    double preprocessMilliseconds = PreprocessMilliseconds(MacroHeavySource(), iterations);
+    double reusedResolutions;
+    double parseMilliseconds = ParseMilliseconds(CallHeavySource(), iterations, reusedResolutions);
+
+    std::vector<TBenchmarkResult> results;
+    for (size_t s = 0; s < sources.size(); ++s)
+        results.push_back(Run(Shaders[s], sources[s], iterations));
+
+    glslang::FinalizeProcess();
+
+    FILE* out = outputName != nullptr ? fopen(outputName, "w") : stdout;
+    if (out == nullptr) {
+        fprintf(stderr, "glslangbenchmarks: cannot write %s\n", outputName);
+        return EXIT_FAILURE;
+    }
+    WriteJson(out, initializeMilliseconds, poolAllocationNanoseconds, preprocessMilliseconds, parseMilliseconds,
+              reusedResolutions, iterations, results);
+    if (out != stdout)
+        fclose(out);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,286 @@
+//
+// Copyright (C) 2020 The Khronos Group Inc.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//    Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+//    Redistributions in binary form must reproduce the above
+//    copyright notice, this list of conditions and the following
+//    disclaimer in the documentation and/or other materials provided
+//    with the distribution.
+//
+//    Neither the name of The Khronos Group Inc. nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <map>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "TestFixture.h"
+
+namespace glslangtest {
+namespace {
+
+using CacheTest = GlslangTest<::testing::Test>;
+
+// Serves headers from memory, by the name written in the #include.
+class MemoryIncluder : public glslang::TShader::Includer {
+public:
+    std::map<std::string, std::string> headers;
+
+    IncludeResult* includeLocal(const char* headerName, const char*, size_t) override
+    {
+        auto header = headers.find(headerName);
+        if (header == headers.end())
+            return nullptr;
+        return new IncludeResult(header->first, header->second.data(), header->second.size(), nullptr);
+    }
+
+    void releaseInclude(IncludeResult* result) override { delete result; }
+};
+
+// Parses the given fragment shader, returning whether it succeeded, its AST and
+// its messages, which give the line of each node and error.
+std::string ParseWithIncludes(const std::string& source, MemoryIncluder& includer,
+                              glslang::TIncludeCache* cache)
+{
+    glslang::TShader shader(EShLangFragment);
+    const char* strings = source.c_str();
+    shader.setStrings(&strings, 1);
+    shader.setIncludeCache(cache);
+    const EShMessages controls = DeriveOptions(Source::GLSL, Semantics::OpenGL, Target::AST);
+    const bool success = shader.parse(&glslang::DefaultTBuiltInResource, 100, false, controls, includer);
+
+    return std::string(success ? "success\n" : "failure\n") + shader.getInfoLog() + shader.getInfoDebugLog();
+}
+
+TEST_F(CacheTest, IncludeCacheMatchesUncachedParse)
+{
+    MemoryIncluder includer;
+    includer.headers["shared.h"] =
+        "#ifdef HIGH_PRECISION\n"
+        "highp float scale() { return 2.0; }\n"
+        "#else\n"
+        "mediump float scale() { return 1.0; }\n"
+        "#endif\n"
+        "\n"
+        "#if VARIANT == 2\n"
+        "float broken() { return undeclared; }\n"
+        "#endif\n"
+        "float tint() { return VARIANT * scale(); }\n";
+
+    // Each includes the header with a different macro state, and from a different line.
+    const std::string sources[] = {
+        "#version 450\n"
+        "#extension GL_GOOGLE_include_directive : enable\n"
+        "#define HIGH_PRECISION\n"
+        "#define VARIANT 1\n"
+        "#include \"shared.h\"\n"
+        "out vec4 color;\n"
+        "void main() { color = vec4(tint()); }\n",
+
+        "#version 450\n"
+        "#extension GL_GOOGLE_include_directive : enable\n"
+        "\n"
+        "\n"
+        "#define VARIANT 2\n"
+        "#include \"shared.h\"\n"
+        "out vec4 color;\n"
+        "void main() { color = vec4(tint() + scale()); }\n",
+    };
+
+    glslang::TIncludeCache cache;
+    for (const std::string& source : sources) {
+        const std::string uncached = ParseWithIncludes(source, includer, nullptr);
+        EXPECT_EQ(uncached, ParseWithIncludes(source, includer, &cache));
+    }
+
+    // The second shader replayed the header the first recorded; replay both again.
+    EXPECT_EQ(1, cache.getNumIncludes());
+    for (const std::string& source : sources)
+        EXPECT_EQ(ParseWithIncludes(source, includer, nullptr), ParseWithIncludes(source, includer, &cache));
+    EXPECT_EQ(1, cache.getNumIncludes());
+}
+
+// Keeps preprocess() results in memory, counting how many were stored.
+class MemoryPreprocessCache : public glslang::TShader::PreprocessCache {
+public:
+    std::map<unsigned long long, Entry> entries;
+    int numStores = 0;
+
+    bool find(unsigned long long key, Entry& entry) override
+    {
+        auto found = entries.find(key);
+        if (found == entries.end())
+            return false;
+        entry = found->second;
+        return true;
+    }
+
+    void store(unsigned long long key, const Entry& entry) override
+    {
+        entries[key] = entry;
+        ++numStores;
+    }
+};
+
+// Preprocesses the given fragment shader, returning whether it succeeded, its
+// output and its info log.
+std::string Preprocess(const std::string& source, const char* preamble, MemoryIncluder& includer,
+                       glslang::TShader::PreprocessCache* cache)
+{
+    glslang::TShader shader(EShLangFragment);
+    const char* strings = source.c_str();
+    shader.setStrings(&strings, 1);
+    shader.setPreamble(preamble);
+    shader.setPreprocessCache(cache);
+    const EShMessages controls = DeriveOptions(Source::GLSL, Semantics::OpenGL, Target::AST);
+    std::string output;
+    const bool success = shader.preprocess(&glslang::DefaultTBuiltInResource, 100, ENoProfile, false, false,
+                                           controls, &output, includer);
+
+    return std::string(success ? "success\n" : "failure\n") + output + "\n" + shader.getInfoLog();
+}
+
+TEST_F(CacheTest, PreprocessCacheHitsAndMisses)
+{
+    MemoryIncluder includer;
+    includer.headers["shared.h"] =
+        "#extension GL_EXT_not_an_extension : warn\n"
+        "float scale() { return FROM_PREAMBLE; }\n";
+    const std::string source =
+        "#version 450\n"
+        "#extension GL_GOOGLE_include_directive : enable\n"
+        "#include \"shared.h\"\n"
+        "void main() { }\n";
+    const char* preamble = "#define FROM_PREAMBLE 1.0\n";
+
+    MemoryPreprocessCache cache;
+    const std::string result = Preprocess(source, preamble, includer, &cache);
+    EXPECT_EQ(Preprocess(source, preamble, includer, nullptr), result);
+    EXPECT_NE(std::string::npos, result.find("not_an_extension"));
+    EXPECT_EQ(1, cache.numStores);
+
+    // A hit gives the same output and info log, without preprocessing again.
+    EXPECT_EQ(result, Preprocess(source, preamble, includer, &cache));
+    EXPECT_EQ(1, cache.numStores);
+
+    // Changing what an include resolves to is a miss.
+    includer.headers["shared.h"] = "float scale() { return 2.0 * FROM_PREAMBLE; }\n";
+    const std::string newHeaderResult = Preprocess(source, preamble, includer, &cache);
+    EXPECT_EQ(Preprocess(source, preamble, includer, nullptr), newHeaderResult);
+    EXPECT_NE(result, newHeaderResult);
+    EXPECT_EQ(2, cache.numStores);
+
+    // So is changing the preamble.
+    const char* newPreamble = "#define FROM_PREAMBLE 3.0\n";
+    const std::string newPreambleResult = Preprocess(source, newPreamble, includer, &cache);
+    EXPECT_EQ(Preprocess(source, newPreamble, includer, nullptr), newPreambleResult);
+    EXPECT_NE(newHeaderResult, newPreambleResult);
+    EXPECT_EQ(3, cache.numStores);
+}
+
+TEST_F(CacheTest, BuiltInResolutionsReused)
+{
+    std::string source;
+    tryLoadFile(GlobalTestSettings.testRoot + "/findFunctionReuse.frag", "input", &source);
+    glslang::TShader shader(EShLangFragment);
+    const EShMessages controls = DeriveOptions(Source::GLSL, Semantics::OpenGL, Target::AST);
+    ASSERT_TRUE(compile(&shader, source, "", controls)) << shader.getInfoLog();
+
+    glslang::TResolutionStats stats;
+    shader.getResolutionStats(stats);
+
+    // first() reuses its second max() and clamp().  After the #extension,
+    // second() resolves both of those signatures again, and its clamp() of a
+    // float16_t.  main() reuses second()'s clamp(); its max() is the user's.
+    EXPECT_EQ(8, stats.builtInCalls);
+    EXPECT_EQ(3, stats.reusedBuiltInCalls);
+}
+
+// Parses a small fragment shader into the given shader.
+void ParseSmallShader(glslang::TShader& shader)
+{
+    const char* source = "#version 450\nout vec4 color;\nvoid main() { color = vec4(1.0); }\n";
+    shader.setStrings(&source, 1);
+    const EShMessages controls = DeriveOptions(Source::GLSL, Semantics::OpenGL, Target::AST);
+    EXPECT_TRUE(shader.parse(&glslang::DefaultTBuiltInResource, 100, false, controls));
+}
+
+// Parses the small shader in a shader of its own, destroyed before returning.
+void ParseAndDestroy()
+{
+    glslang::TShader shader(EShLangFragment);
+    ParseSmallShader(shader);
+}
+
+TEST_F(CacheTest, PoolPagesAreCachedAndReused)
+{
+    const size_t defaultLimit = 4 * 1024 * 1024;
+
+    // Set up the built-ins first, which keeps pages for as long as the process.
+    ParseAndDestroy();
+    glslang::SetPoolPageCacheLimit(0);
+
+    glslang::TPoolStatistics start;
+    glslang::GetPoolStatistics(start);
+    EXPECT_EQ(0u, start.pagesCached);
+
+    // A destroyed shader's pages are kept, not freed.
+    glslang::SetPoolPageCacheLimit(defaultLimit);
+    ParseAndDestroy();
+    glslang::TPoolStatistics afterFirst;
+    glslang::GetPoolStatistics(afterFirst);
+    EXPECT_LT(0u, afterFirst.pagesCached);
+    EXPECT_EQ(start.pagesLive, afterFirst.pagesLive);
+    EXPECT_LT(start.bytesAllocated, afterFirst.bytesAllocated);
+
+    // The next shader takes them while it lives, and needs no more.
+    {
+        glslang::TShader shader(EShLangFragment);
+        ParseSmallShader(shader);
+        glslang::TPoolStatistics during;
+        glslang::GetPoolStatistics(during);
+        EXPECT_GT(afterFirst.pagesCached, during.pagesCached);
+        EXPECT_EQ(afterFirst.pagesLive + (afterFirst.pagesCached - during.pagesCached), during.pagesLive);
+    }
+    glslang::TPoolStatistics afterSecond;
+    glslang::GetPoolStatistics(afterSecond);
+    EXPECT_EQ(afterFirst.pagesCached, afterSecond.pagesCached);
+    EXPECT_EQ(start.pagesLive, afterSecond.pagesLive);
+
+    // With no retention, pages go back to the system.
+    glslang::SetPoolPageCacheLimit(0);
+    ParseAndDestroy();
+    glslang::TPoolStatistics end;
+    glslang::GetPoolStatistics(end);
+    EXPECT_EQ(start.pagesCached, end.pagesCached);
+    EXPECT_EQ(start.pagesLive, end.pagesLive);
+
+    glslang::SetPoolPageCacheLimit(defaultLimit);
+}
+
+}  // anonymous namespace
+}  // namespace glslangtest
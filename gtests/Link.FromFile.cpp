@@ -37,6 +37,7 @@
 #include <gtest/gtest.h>
 
 #include "TestFixture.h"
+#include "glslang/Include/Types.h"
 
 namespace glslangtest {
 namespace {
@@ -85,6 +86,176 @@ TEST_P(LinkTest, FromFile)
     checkEqAndUpdateIfRequested(expectedOutput, stream.str(), expectedOutputFname);
 }
 
+using ReleaseIntermediatesTest = GlslangTest<::testing::Test>;
+
+// Everything reflection reports about the program, one object per line.
+std::string DescribeReflection(const glslang::TProgram& program)
+{
+    std::ostringstream stream;
+    const auto describe = [&stream](const char* kind, const glslang::TObjectReflection& object) {
+        stream << kind << " " << object.name << " " << object.offset << " " << object.glDefineType << " "
+               << object.size << " " << object.index << " " << object.stages << " "
+               << (object.getType() != nullptr ? object.getType()->getCompleteString() : "") << "\n";
+    };
+    for (int i = 0; i < program.getNumUniformVariables(); ++i)
+        describe("uniform", program.getUniform(i));
+    for (int i = 0; i < program.getNumUniformBlocks(); ++i)
+        describe("block", program.getUniformBlock(i));
+    for (int i = 0; i < program.getNumPipeInputs(); ++i)
+        describe("input", program.getPipeInput(i));
+    for (int i = 0; i < program.getNumPipeOutputs(); ++i)
+        describe("output", program.getPipeOutput(i));
+    for (int i = 0; i < program.getNumBufferVariables(); ++i)
+        describe("buffer variable", program.getBufferVariable(i));
+    for (int i = 0; i < program.getNumBufferBlocks(); ++i)
+        describe("buffer block", program.getBufferBlock(i));
+
+    return stream.str();
+}
+
+TEST_F(ReleaseIntermediatesTest, ReflectionSurvivesRelease)
+{
+    const std::vector<std::string> fileNames = {"reflection.vert", "reflection.frag"};
+    const EShMessages controls = DeriveOptions(Source::GLSL, Semantics::OpenGL, Target::AST);
+
+    std::vector<std::string> contents(fileNames.size());
+    std::vector<std::unique_ptr<glslang::TShader>> shaders;
+    glslang::TProgram program;
+    for (size_t i = 0; i < fileNames.size(); ++i) {
+        tryLoadFile(GlobalTestSettings.testRoot + "/" + fileNames[i], "input", &contents[i]);
+        shaders.emplace_back(new glslang::TShader(GetShaderStage(GetSuffix(fileNames[i]))));
+        ASSERT_TRUE(compile(shaders.back().get(), contents[i], "", controls)) << shaders.back()->getInfoLog();
+        program.addShader(shaders.back().get());
+    }
+    ASSERT_TRUE(program.link(controls)) << program.getInfoLog();
+    ASSERT_TRUE(program.buildReflection());
+
+    const std::string reflection = DescribeReflection(program);
+    ASSERT_GT(program.getNumUniformVariables(), 0);
+    const std::string firstUniform = program.getUniform(0).name;
+    const int firstUniformIndex = program.getReflectionIndex(firstUniform.c_str());
+
+    program.releaseIntermediates();
+
+    EXPECT_EQ(nullptr, program.getIntermediate(EShLangVertex));
+    EXPECT_EQ(reflection, DescribeReflection(program));
+    EXPECT_EQ(firstUniformIndex, program.getReflectionIndex(firstUniform.c_str()));
+
+    // The shaders are left usable, with new, empty intermediates.
+    for (size_t i = 0; i < shaders.size(); ++i) {
+        ASSERT_NE(nullptr, shaders[i]->getIntermediate());
+        EXPECT_TRUE(compile(shaders[i].get(), contents[i], "", controls)) << shaders[i]->getInfoLog();
+    }
+}
+
+using MemoryStatsTest = GlslangTest<::testing::Test>;
+
+// A category is in use, and holds no more than it did at its peak.
+void ExpectMemoryInUse(const glslang::TMemoryUsage& usage, const char* category)
+{
+    EXPECT_LT(0u, usage.peak) << category;
+    EXPECT_LE(usage.current, usage.peak) << category;
+}
+
+TEST_F(MemoryStatsTest, CategoriesAreInUse)
+{
+    // Two units of one stage, for the program to link into an intermediate of its own.
+    const std::string sources[] = {
+        "#version 450\n"
+        "layout(location = 0) out vec4 color;\n"
+        "vec4 tint();\n"
+        "void main() { color = tint(); }\n",
+
+        "#version 450\n"
+        "vec4 tint() { return vec4(0.25, 0.5, 0.75, 1.0); }\n",
+    };
+    const EShMessages controls = DeriveOptions(Source::GLSL, Semantics::Vulkan, Target::Spv);
+
+    std::vector<std::unique_ptr<glslang::TShader>> shaders;
+    glslang::TProgram program;
+    for (const std::string& source : sources) {
+        shaders.emplace_back(new glslang::TShader(EShLangFragment));
+        shaders.back()->setEnvInput(glslang::EShSourceGlsl, EShLangFragment, glslang::EShClientVulkan, 100);
+        shaders.back()->setEnvClient(glslang::EShClientVulkan, glslang::EShTargetVulkan_1_0);
+        shaders.back()->setEnvTarget(glslang::EShTargetSpv, glslang::EShTargetSpv_1_0);
+        ASSERT_TRUE(compile(shaders.back().get(), source, "", controls)) << shaders.back()->getInfoLog();
+        program.addShader(shaders.back().get());
+    }
+    ASSERT_TRUE(program.link(controls)) << program.getInfoLog();
+
+    std::vector<unsigned int> spirv;
+    glslang::GlslangToSpv(*program.getIntermediate(EShLangFragment), spirv);
+    ASSERT_FALSE(spirv.empty());
+
+    glslang::TMemoryStats stats;
+    shaders.front()->getMemoryStats(stats);
+    ExpectMemoryInUse(stats.poolPages, "shader pool pages");
+    ExpectMemoryInUse(stats.ast, "shader AST");
+    ExpectMemoryInUse(stats.symbolTable, "shader symbol table");
+    ExpectMemoryInUse(stats.strings, "shader strings");
+    EXPECT_EQ(0u, stats.spirv.peak);
+
+    program.getMemoryStats(stats);
+    ExpectMemoryInUse(stats.poolPages, "program pool pages");
+    ExpectMemoryInUse(stats.ast, "program AST");
+    ExpectMemoryInUse(stats.spirv, "program SPIR-V");
+    EXPECT_LT(0u, stats.spirv.current);
+    EXPECT_LE(stats.symbolTable.current, stats.symbolTable.peak);
+    EXPECT_LE(stats.strings.current, stats.strings.peak);
+}
+
+using LinkAgainTest = GlslangTest<::testing::Test>;
+
+// Links the shader into a program of its own and generates its SPIR-V.
+std::vector<unsigned int> LinkToSpv(glslang::TShader& shader, EShMessages controls)
+{
+    std::vector<unsigned int> spirv;
+    glslang::TProgram program;
+    program.addShader(&shader);
+    if (program.link(controls))
+        glslang::GlslangToSpv(*program.getIntermediate(shader.getStage()), spirv);
+
+    return spirv;
+}
+
+TEST_F(LinkAgainTest, ShaderOutlivesFirstProgram)
+{
+    const std::string source =
+        "#version 450\n"
+        "layout(location = 0) in vec4 position;\n"
+        "layout(location = 1) in vec2 texCoord;\n"
+        "layout(location = 0) out vec2 outTexCoord;\n"
+        "layout(binding = 0) uniform Transform { mat4 mvp; } transform;\n"
+        "void main()\n"
+        "{\n"
+        "    outTexCoord = texCoord * 0.5;\n"
+        "    gl_Position = transform.mvp * position;\n"
+        "}\n";
+    const EShMessages controls = DeriveOptions(Source::GLSL, Semantics::Vulkan, Target::Spv);
+
+    glslang::TShader shader(EShLangVertex);
+    shader.setEnvInput(glslang::EShSourceGlsl, EShLangVertex, glslang::EShClientVulkan, 100);
+    shader.setEnvClient(glslang::EShClientVulkan, glslang::EShTargetVulkan_1_0);
+    shader.setEnvTarget(glslang::EShTargetSpv, glslang::EShTargetSpv_1_0);
+    ASSERT_TRUE(compile(&shader, source, "", controls)) << shader.getInfoLog();
+
+    // The first program, and its pool, are gone before the second is linked.
+    const std::vector<unsigned int> first = LinkToSpv(shader, controls);
+    ASSERT_FALSE(first.empty());
+
+    glslang::TProgram program;
+    program.addShader(&shader);
+    ASSERT_TRUE(program.link(controls)) << program.getInfoLog();
+
+    // Reuse what the first program's pool held.
+    for (int i = 0; i < 64; ++i)
+        memset(glslang::GetThreadPoolAllocator().allocate(1024), 0xff, 1024);
+
+    std::vector<unsigned int> second;
+    glslang::GlslangToSpv(*program.getIntermediate(EShLangVertex), second);
+    EXPECT_EQ(first, second);
+}
+
 // clang-format off
 INSTANTIATE_TEST_CASE_P(
     Glsl, LinkTest,
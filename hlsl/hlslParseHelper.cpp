@@ -110,7 +110,7 @@ void HlslParseContext::initializeExtensionBehavior()
     TParseContextBase::initializeExtensionBehavior();
 
     // HLSL allows #line by default.
-    extensionBehavior[E_GL_GOOGLE_cpp_style_line_directive] = EBhEnable;
+    extensionBehavior[E_GL_GOOGLE_cpp_style_line_directive.id] = EBhEnable;
 }
 
 void HlslParseContext::setLimits(const TBuiltInResource& r)
@@ -552,11 +552,9 @@ void HlslParseContext::handlePragma(const TSourceLoc& loc, const TVector<TString
         return;
     }
 
-    // Handle once
-    if (lowerTokens[0] == "once") {
-        warn(loc, "not implemented", "#pragma once", "");
+    // Handle once: done by the preprocessor, for included files
+    if (lowerTokens[0] == "once")
         return;
-    }
 }
 
 //